@@ -12,8 +12,11 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 
+#include "Engine/Core/Memory/AllocationTracker.hpp"
+#include "Engine/Core/Memory/FrameAllocator.hpp"
 #include "Engine/Platform/Events/EventListener.hpp"
 #include "Engine/Platform/Events/TypedEventListener.hpp"
 
@@ -39,6 +42,18 @@ namespace Engine::Core
     [[nodiscard]] Platform::Window &   GetWindow() const;
     [[nodiscard]] Renderer::Renderer & GetRenderer() const;
 
+    // Scratch memory for Update() and Draw(), reclaimed at the top of every
+    // frame.  Pass it to std::pmr containers for per-frame temporaries.
+    [[nodiscard]] FrameAllocator & GetFrameAllocator();
+
+    // Heap traffic on this thread during the last completed frame; all zero
+    // unless the engine is built with TRIUMPH_TRACK_ALLOCATIONS.
+    [[nodiscard]] AllocationStats GetLastFrameAllocations() const;
+
+    // Makes a tracked build fail once a frame past warm-up exceeds
+    // maxAllocations heap allocations.
+    void SetFrameAllocationBudget( u64 maxAllocations );
+
   protected:
     virtual void Init()                  = 0;
     virtual void Update( f32 deltaTime ) = 0;
@@ -49,6 +64,8 @@ namespace Engine::Core
     void InternalInit();
     void InternalShutdown();
     void SetupEngineEventListeners();
+    void BeginFrameAllocations();
+    void EndFrameAllocations();
 
     std::unique_ptr<Platform::Window>   m_pWindow;
     std::unique_ptr<Renderer::Renderer> m_pRenderer;
@@ -56,6 +73,17 @@ namespace Engine::Core
     Platform::Events::WindowCloseListener  m_CloseListener;
     Platform::Events::WindowResizeListener m_ResizeListener;
 
+    FrameAllocator m_FrameAllocator;
+
+    AllocationStats m_FrameStartAllocations;
+    AllocationStats m_LastFrameAllocations;
+    u64             m_FrameAllocationBudget;
+    u64             m_FrameIndex;
+
+    // Only tags below m_FrameStartTagCount have a snapshot for the frame.
+    std::array<AllocationStats, AllocationTracker::s_MaxTags> m_FrameStartTags;
+    u32                                                       m_FrameStartTagCount;
+
     bool m_IsRunning;
     f32  m_LastFrameTime;
   };
@@ -0,0 +1,66 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <format>
+#include <string>
+#include <string_view>
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine
+{
+  // A failure that is cheap to create and copy: a static reason plus an optional
+  // code.  Text that depends on the code is built only when the error is
+  // formatted, and the logger does that on its writer thread.
+  class Error
+  {
+  public:
+    using DescribeFn = std::string ( * )( i32 code );
+
+    constexpr Error() = default;
+
+    constexpr explicit Error( const char * pReason, const i32 code = 0,
+                              const DescribeFn pDescribe = nullptr )
+      : m_pReason( pReason )
+      , m_Code( code )
+      , m_pDescribe( pDescribe )
+    {
+    }
+
+    [[nodiscard]] constexpr const char * GetReason() const
+    {
+      return m_pReason;
+    }
+
+    [[nodiscard]] constexpr i32 GetCode() const
+    {
+      return m_Code;
+    }
+
+    [[nodiscard]] std::string ToString() const;
+
+  private:
+    const char * m_pReason   = "";
+    i32          m_Code      = 0;
+    DescribeFn   m_pDescribe = nullptr;
+  };
+} // namespace Engine
+
+template <> struct std::formatter<Engine::Error> : std::formatter<std::string_view>
+{
+  auto format( const Engine::Error & error, std::format_context & ctx ) const
+  {
+    return std::formatter<std::string_view>::format( error.ToString(), ctx );
+  }
+};
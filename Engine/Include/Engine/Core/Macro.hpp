@@ -27,3 +27,27 @@ public:
                                                                                     \
 private:                                                                            \
   static_assert( true, "" )
+
+#if defined( _WIN32 )
+#include <intrin.h>
+#define DEBUG_BREAK() __debugbreak()
+#elif defined( __clang__ )
+#define DEBUG_BREAK() __builtin_debugtrap()
+#else
+#include <csignal>
+#define DEBUG_BREAK() std::raise( SIGTRAP )
+#endif
+
+#if defined( _M_X64 ) || defined( __x86_64__ )
+#define TRIUMPH_ARCH_X64 1
+#elif defined( _M_ARM64 ) || defined( __aarch64__ )
+#define TRIUMPH_ARCH_ARM64 1
+#endif
+
+// Compiles a single function for an instruction set the rest of the build does
+// not assume; callers must check CPU support first.  MSVC needs no opt-in.
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#define TARGET_ISA( isa )
+#else
+#define TARGET_ISA( isa ) __attribute__( ( target( isa ) ) )
+#endif
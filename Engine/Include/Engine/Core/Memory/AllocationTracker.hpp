@@ -0,0 +1,94 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Types.hpp"
+
+#if !defined( TRIUMPH_TRACK_ALLOCATIONS )
+#define TRIUMPH_TRACK_ALLOCATIONS 0
+#endif
+
+namespace Engine::Core
+{
+  struct AllocationStats
+  {
+    u64 m_Allocations = 0;
+    u64 m_Frees       = 0;
+    u64 m_Bytes       = 0;
+
+    [[nodiscard]] constexpr AllocationStats
+    operator-( const AllocationStats & other ) const
+    {
+      return { m_Allocations - other.m_Allocations, m_Frees - other.m_Frees,
+               m_Bytes - other.m_Bytes };
+    }
+  };
+
+  // Counts global operator new/delete traffic when the engine is built with
+  // TRIUMPH_TRACK_ALLOCATIONS; otherwise every query reports zero.  Counters are
+  // cumulative, so callers diff two snapshots.  Only allocations are attributed
+  // to a tag, and a tag's counters sum over all threads.
+  class AllocationTracker
+  {
+  public:
+    static constexpr u32 s_MaxTags     = 64;
+    static constexpr u32 s_UntaggedTag = 0;
+
+    [[nodiscard]] static constexpr bool IsEnabled()
+    {
+      return TRIUMPH_TRACK_ALLOCATIONS != 0;
+    }
+
+    [[nodiscard]] static AllocationStats GetThreadStats();
+
+    // Tags with the same name share one slot.  Past s_MaxTags, allocations fall
+    // back to s_UntaggedTag.
+    [[nodiscard]] static u32 RegisterTag( const char * pName );
+
+    [[nodiscard]] static u32             GetTagCount();
+    [[nodiscard]] static const char *    GetTagName( u32 tag );
+    [[nodiscard]] static AllocationStats GetTagStats( u32 tag );
+  };
+
+  // Attributes the calling thread's allocations to a tag until it goes out of
+  // scope.  Use TRIUMPH_MEMORY_SCOPE rather than naming one directly.
+  class MemoryScope
+  {
+    DISALLOW_COPY( MemoryScope );
+    DISALLOW_MOVE( MemoryScope );
+
+  public:
+    explicit MemoryScope( u32 tag );
+    ~MemoryScope();
+
+  private:
+    u32 m_Previous;
+  };
+} // namespace Engine::Core
+
+#if TRIUMPH_TRACK_ALLOCATIONS
+#define TRIUMPH_MEMORY_SCOPE_IMPL( name, id )                                       \
+  const Engine::Core::MemoryScope TriumphMemoryScope##id(                           \
+    []                                                                              \
+    {                                                                               \
+      static const auto s_Tag =                                                     \
+        Engine::Core::AllocationTracker::RegisterTag( name );                       \
+      return s_Tag;                                                                 \
+    }() )
+#define TRIUMPH_MEMORY_SCOPE_ID( name, id )                                         \
+  TRIUMPH_MEMORY_SCOPE_IMPL( name, id )
+#define TRIUMPH_MEMORY_SCOPE( name ) TRIUMPH_MEMORY_SCOPE_ID( name, __COUNTER__ )
+#else
+#define TRIUMPH_MEMORY_SCOPE( name ) static_assert( true, "" )
+#endif
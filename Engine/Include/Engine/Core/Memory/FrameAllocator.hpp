@@ -0,0 +1,69 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <memory_resource>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Memory/LinearArena.hpp"
+#include "Engine/Core/Types.hpp"
+
+#if !defined( TRIUMPH_FRAME_ARENA_BUFFERS )
+#define TRIUMPH_FRAME_ARENA_BUFFERS 1
+#endif
+
+namespace Engine::Core
+{
+  // Scratch memory that lives until the start of a later frame.  With one
+  // buffer, BeginFrame() resets the only arena; with two or three, it rotates to
+  // the oldest one, so data handed to a consumer running a frame or two behind
+  // stays valid until that consumer is done with it.
+  class FrameAllocator : public std::pmr::memory_resource
+  {
+    DISALLOW_COPY( FrameAllocator );
+    DISALLOW_MOVE( FrameAllocator );
+
+  public:
+    static constexpr u32 s_MaxBuffers = 3;
+
+    FrameAllocator( size capacityPerFrame, u32 bufferCount );
+    ~FrameAllocator() override = default;
+
+    void BeginFrame();
+
+    [[nodiscard]] LinearArena & GetCurrentArena() const;
+    [[nodiscard]] u32           GetBufferCount() const;
+
+    // Largest number of bytes any single frame has used.
+    [[nodiscard]] size GetHighWater() const;
+    [[nodiscard]] size GetCapacity() const;
+    [[nodiscard]] u32  GetOverflowCount() const;
+
+  private:
+    void * do_allocate( size bytes, size alignment ) override;
+    void   do_deallocate( void * pData, size bytes, size alignment ) override;
+    bool   do_is_equal(
+      const std::pmr::memory_resource & other ) const noexcept override;
+
+    std::array<std::unique_ptr<LinearArena>, s_MaxBuffers> m_pArenas;
+
+    u32 m_BufferCount;
+    u32 m_Current;
+  };
+
+  static_assert( TRIUMPH_FRAME_ARENA_BUFFERS >= 1 &&
+                   TRIUMPH_FRAME_ARENA_BUFFERS <= FrameAllocator::s_MaxBuffers,
+                 "TRIUMPH_FRAME_ARENA_BUFFERS must be 1, 2 or 3" );
+} // namespace Engine::Core
@@ -0,0 +1,71 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Core
+{
+  // Bump allocator over one contiguous block.  Memory is only reclaimed by
+  // Reset(); deallocate() merely rolls back the most recent allocation so a
+  // growing pmr container can reuse its own tail.  Running past the block falls
+  // back to overflow chunks, and the next Reset() replaces the block with one
+  // large enough for the peak, so a steady workload settles on zero heap calls.
+  // Not thread-safe.
+  class LinearArena : public std::pmr::memory_resource
+  {
+    DISALLOW_COPY( LinearArena );
+    DISALLOW_MOVE( LinearArena );
+
+  public:
+    explicit LinearArena( size capacity );
+    ~LinearArena() override = default;
+
+    void Reset();
+
+    [[nodiscard]] size GetCapacity() const;
+    [[nodiscard]] size GetUsed() const;
+    [[nodiscard]] size GetHighWater() const;
+    [[nodiscard]] u32  GetOverflowCount() const;
+
+  private:
+    struct Chunk
+    {
+      std::unique_ptr<std::byte[]> m_pData;
+      size                         m_Capacity;
+    };
+
+    void * do_allocate( size bytes, size alignment ) override;
+    void   do_deallocate( void * pData, size bytes, size alignment ) override;
+    bool   do_is_equal(
+      const std::pmr::memory_resource & other ) const noexcept override;
+
+    void * AllocateOverflow( size bytes, size alignment );
+
+    std::unique_ptr<std::byte[]> m_pBlock;
+    size                         m_Capacity;
+    size                         m_Offset;
+
+    std::vector<Chunk> m_Overflow;
+    size               m_OverflowOffset;
+
+    size m_Used;
+    size m_HighWater;
+    u32  m_OverflowCount;
+  };
+} // namespace Engine::Core
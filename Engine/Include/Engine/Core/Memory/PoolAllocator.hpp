@@ -0,0 +1,55 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Core
+{
+  struct PoolStats
+  {
+    size m_BlockSize;
+    size m_ReservedBytes;
+    u64  m_Allocations;
+    u64  m_Frees;
+  };
+
+  // Fixed-size blocks for small engine objects, in power-of-two size classes.
+  // Each thread allocates from and frees into its own cache; the caches trade
+  // whole batches with a lock-free list per class, so a block freed on another
+  // thread only touches shared state once per batch.  Requests larger than
+  // s_MaxBlockSize go to the global heap.  Pool memory is never returned to the
+  // system.
+  class PoolAllocator
+  {
+  public:
+    static constexpr size s_MinBlockSize = 16;
+    static constexpr size s_MaxBlockSize = 512;
+    static constexpr size s_Alignment    = 16;
+    static constexpr u32  s_ClassCount   = 6;
+    static constexpr u32  s_BatchSize    = 32;
+
+    [[nodiscard]] static void * Allocate( size bytes );
+    static void                 Free( void * pBlock, size bytes );
+
+    // Hands the calling thread's cached blocks back to the shared lists.  Runs
+    // automatically when a thread exits.
+    static void FlushThreadCache();
+
+    // Allocation and free counts are published a batch at a time, so they may
+    // lag the calling threads by up to 2 * s_BatchSize per class.
+    [[nodiscard]] static std::array<PoolStats, s_ClassCount> GetStats();
+  };
+} // namespace Engine::Core
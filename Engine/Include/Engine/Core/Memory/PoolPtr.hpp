@@ -0,0 +1,71 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Engine/Core/Memory/PoolAllocator.hpp"
+
+namespace Engine::Core
+{
+  // Destroys and releases an object created by MakePooled.  The block size
+  // travels with the deleter so a PoolPtr<Derived> can become a PoolPtr<Base>.
+  template <typename T> struct PoolDeleter
+  {
+    size m_Size = sizeof( T );
+
+    PoolDeleter() = default;
+
+    template <typename U>
+      requires std::is_convertible_v<U *, T *> && std::has_virtual_destructor_v<T>
+    PoolDeleter( const PoolDeleter<U> & other )
+      : m_Size( other.m_Size )
+    {
+    }
+
+    void operator()( T * pObject ) const
+    {
+      // A base subobject need not start at the block, but the most derived
+      // object always does.
+      void * pBlock = pObject;
+      if constexpr ( std::is_polymorphic_v<T> )
+      {
+        pBlock = dynamic_cast<void *>( pObject );
+      }
+
+      pObject->~T();
+      PoolAllocator::Free( pBlock, m_Size );
+    }
+  };
+
+  template <typename T> using PoolPtr = std::unique_ptr<T, PoolDeleter<T>>;
+
+  template <typename T, typename... Args> PoolPtr<T> MakePooled( Args &&... args )
+  {
+    static_assert( alignof( T ) <= PoolAllocator::s_Alignment );
+
+    void * pBlock = PoolAllocator::Allocate( sizeof( T ) );
+    try
+    {
+      return PoolPtr<T>( ::new ( pBlock ) T( std::forward<Args>( args )... ) );
+    }
+    catch ( ... )
+    {
+      PoolAllocator::Free( pBlock, sizeof( T ) );
+      throw;
+    }
+  }
+} // namespace Engine::Core
@@ -0,0 +1,81 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <memory_resource>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Memory/VirtualMemory.hpp"
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Core
+{
+  // LIFO scratch allocator over a VirtualBuffer.  Callers take a marker, make
+  // any number of allocations and rewind to the marker to free them all; pages
+  // are committed as the top first reaches them.  Running out of reservation
+  // throws std::bad_alloc.  Not thread-safe.
+  class StackAllocator : public std::pmr::memory_resource
+  {
+    DISALLOW_COPY( StackAllocator );
+    DISALLOW_MOVE( StackAllocator );
+
+  public:
+    using Marker = size;
+
+    explicit StackAllocator( size reserveBytes );
+    ~StackAllocator() override = default;
+
+    [[nodiscard]] Marker GetMarker() const;
+    void                 Rewind( Marker marker );
+
+    // Hands pages above the current top back to the OS.
+    void Trim();
+
+    [[nodiscard]] size GetUsed() const;
+    [[nodiscard]] size GetHighWater() const;
+    [[nodiscard]] size GetCommittedBytes() const;
+
+  private:
+    void * do_allocate( size bytes, size alignment ) override;
+    void   do_deallocate( void * pData, size bytes, size alignment ) override;
+    bool   do_is_equal(
+      const std::pmr::memory_resource & other ) const noexcept override;
+
+    VirtualBuffer m_Buffer;
+    size          m_Top;
+    size          m_HighWater;
+  };
+
+  // Rewinds a StackAllocator to where it stood when the scope began.
+  class StackScope
+  {
+    DISALLOW_COPY( StackScope );
+    DISALLOW_MOVE( StackScope );
+
+  public:
+    explicit StackScope( StackAllocator & allocator )
+      : m_Allocator( allocator )
+      , m_Marker( allocator.GetMarker() )
+    {
+    }
+
+    ~StackScope()
+    {
+      m_Allocator.Rewind( m_Marker );
+    }
+
+  private:
+    StackAllocator &       m_Allocator;
+    StackAllocator::Marker m_Marker;
+  };
+} // namespace Engine::Core
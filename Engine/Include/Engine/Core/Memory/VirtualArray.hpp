@@ -0,0 +1,184 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Memory/VirtualMemory.hpp"
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Core
+{
+  // A growable array backed by a fixed reservation of maxCount elements.
+  // Growth commits more pages in place instead of reallocating, so elements
+  // never move and pointers to them stay valid until they are removed.
+  // Growing past maxCount throws std::bad_alloc.
+  template <typename T> class VirtualArray
+  {
+    DISALLOW_COPY( VirtualArray );
+    DISALLOW_MOVE( VirtualArray );
+
+  public:
+    explicit VirtualArray( const size maxCount )
+      : m_Buffer( maxCount * sizeof( T ) )
+      , m_Size( 0 )
+      , m_MaxCount( maxCount )
+      , m_DirtyBytes( 0 )
+    {
+    }
+
+    ~VirtualArray()
+    {
+      Clear();
+    }
+
+    template <typename... Args> T & EmplaceBack( Args &&... args )
+    {
+      Grow( m_Size + 1 );
+
+      T * pElement = ::new ( GetData() + m_Size ) T( std::forward<Args>( args )... );
+      ++m_Size;
+      m_DirtyBytes = std::max( m_DirtyBytes, m_Size * sizeof( T ) );
+      return *pElement;
+    }
+
+    T & PushBack( const T & value )
+    {
+      return EmplaceBack( value );
+    }
+
+    T & PushBack( T && value )
+    {
+      return EmplaceBack( std::move( value ) );
+    }
+
+    void PopBack()
+    {
+      --m_Size;
+      std::destroy_at( GetData() + m_Size );
+    }
+
+    // New elements are value-initialized.  For trivial types only memory that
+    // was written before needs clearing, since freshly committed pages read as
+    // zero; growing into new pages then costs no more than committing them.
+    void Resize( const size count )
+    {
+      if ( count < m_Size )
+      {
+        std::destroy( GetData() + count, GetData() + m_Size );
+      }
+      else if constexpr ( std::is_trivially_default_constructible_v<T> )
+      {
+        Grow( count );
+
+        auto *     pStart = reinterpret_cast<std::byte *>( GetData() + m_Size );
+        const auto Dirty  = std::min( m_DirtyBytes, count * sizeof( T ) );
+        const auto Offset = m_Size * sizeof( T );
+        if ( Dirty > Offset )
+        {
+          std::memset( pStart, 0, Dirty - Offset );
+        }
+      }
+      else
+      {
+        Grow( count );
+        std::uninitialized_value_construct( GetData() + m_Size, GetData() + count );
+      }
+
+      m_Size       = count;
+      m_DirtyBytes = std::max( m_DirtyBytes, m_Size * sizeof( T ) );
+    }
+
+    void Clear()
+    {
+      std::destroy( GetData(), GetData() + m_Size );
+      m_Size = 0;
+    }
+
+    // Hands committed pages past the last element back to the OS.
+    void ShrinkToFit()
+    {
+      m_Buffer.Decommit( m_Size * sizeof( T ) );
+      m_DirtyBytes = std::min( m_DirtyBytes, m_Buffer.GetCommittedSize() );
+    }
+
+    [[nodiscard]] T * GetData() const
+    {
+      return std::launder( reinterpret_cast<T *>( m_Buffer.GetData() ) );
+    }
+
+    [[nodiscard]] size GetSize() const
+    {
+      return m_Size;
+    }
+
+    [[nodiscard]] size GetMaxSize() const
+    {
+      return m_MaxCount;
+    }
+
+    [[nodiscard]] size GetCommittedBytes() const
+    {
+      return m_Buffer.GetCommittedSize();
+    }
+
+    [[nodiscard]] bool IsEmpty() const
+    {
+      return m_Size == 0;
+    }
+
+    [[nodiscard]] std::span<T> View() const
+    {
+      return { GetData(), m_Size };
+    }
+
+    T & operator[]( const size index ) const
+    {
+      return GetData()[ index ];
+    }
+
+    T * begin() const
+    {
+      return GetData();
+    }
+
+    T * end() const
+    {
+      return GetData() + m_Size;
+    }
+
+  private:
+    void Grow( const size count )
+    {
+      if ( count > m_MaxCount || !m_Buffer.EnsureCommitted( count * sizeof( T ) ) )
+      {
+        throw std::bad_alloc();
+      }
+    }
+
+    VirtualBuffer m_Buffer;
+    size          m_Size;
+    size          m_MaxCount;
+
+    // Bytes from the start that may hold old data; everything committed past
+    // it is still zero from the OS.
+    size m_DirtyBytes;
+  };
+} // namespace Engine::Core
@@ -0,0 +1,67 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Result.hpp"
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Core
+{
+  // Thin wrappers over the OS page allocator.  Reserved address space is
+  // inaccessible until committed; sizes and addresses are page aligned.
+  namespace VirtualMemory
+  {
+    [[nodiscard]] size GetPageSize();
+    [[nodiscard]] size RoundToPages( size bytes );
+
+    [[nodiscard]] Result<std::byte *> Reserve( size bytes );
+    [[nodiscard]] bool                Commit( std::byte * pAddress, size bytes );
+    void                              Decommit( std::byte * pAddress, size bytes );
+    void                              Release( std::byte * pAddress, size bytes );
+  } // namespace VirtualMemory
+
+  // A reserved range whose committed prefix grows on demand, so its address
+  // never changes.  One page past the reservation is kept as a guard so an
+  // overrun faults instead of reaching a neighbouring mapping.
+  class VirtualBuffer
+  {
+    DISALLOW_COPY( VirtualBuffer );
+    DISALLOW_MOVE( VirtualBuffer );
+
+  public:
+    // Throws std::bad_alloc if the address space cannot be reserved.
+    explicit VirtualBuffer( size reserveBytes, bool hasGuardPage = true );
+    ~VirtualBuffer();
+
+    // Commits at least the first bytes of the buffer, growing geometrically so
+    // repeated small requests cost O(log n) system calls.  Returns false when
+    // bytes exceeds the reservation or the OS refuses.
+    [[nodiscard]] bool EnsureCommitted( size bytes );
+
+    // Returns every committed page past the first bytes to the OS.
+    void Decommit( size keepBytes );
+
+    [[nodiscard]] std::byte * GetData() const;
+    [[nodiscard]] size        GetReservedSize() const;
+    [[nodiscard]] size        GetCommittedSize() const;
+
+  private:
+    std::byte * m_pData;
+    size        m_Reserved;
+    size        m_Committed;
+    size        m_Mapped;
+  };
+} // namespace Engine::Core
@@ -12,42 +12,44 @@
 
 #pragma once
 
+#include <functional>
+#include <type_traits>
+#include <utility>
 #include <variant>
-#include <string>
 
-#include <Engine/Core/Macro.hpp>
+#include "Engine/Core/Error.hpp"
+#include "Engine/Core/Types.hpp"
 
 namespace Engine
 {
-  template <typename T, typename E = std::string> class Result
+  // Holds either a value or an error.  Copies and moves follow T and E, so the
+  // default Result<T> is trivially copyable whenever T is.
+  template <typename T, typename E = Error> class Result
   {
-    DISALLOW_COPY( Result );
-    DISALLOW_MOVE( Result );
-
   public:
     Result( T && value )
-      : m_Data( std::forward<T>( value ) )
+      : m_Data( std::in_place_index<0>, std::move( value ) )
     {
     }
 
     Result( const T & value )
-      : m_Data( value )
+      : m_Data( std::in_place_index<0>, value )
     {
     }
 
     Result( E && error )
-      : m_Data( std::forward<E>( error ) )
+      : m_Data( std::in_place_index<1>, std::move( error ) )
     {
     }
 
     Result( const E & error )
-      : m_Data( error )
+      : m_Data( std::in_place_index<1>, error )
     {
     }
 
     [[nodiscard]] bool IsValid() const
     {
-      return std::holds_alternative<T>( m_Data );
+      return m_Data.index() == 0;
     }
 
     explicit operator bool() const
@@ -55,37 +57,140 @@ namespace Engine
       return IsValid();
     }
 
-    [[nodiscard]] const T & GetValue() const
+    [[nodiscard]] const T & GetValue() const &
+    {
+      return std::get<0>( m_Data );
+    }
+
+    T & GetValue() &
     {
-      return std::get<T>( m_Data );
+      return std::get<0>( m_Data );
     }
 
-    T & GetValue()
+    T && GetValue() &&
     {
-      return std::get<T>( m_Data );
+      return std::get<0>( std::move( m_Data ) );
     }
 
-    [[nodiscard]] const E & GetError() const
+    [[nodiscard]] const E & GetError() const &
     {
-      return std::get<E>( m_Data );
+      return std::get<1>( m_Data );
     }
 
-    E & GetError()
+    E & GetError() &
     {
-      return std::get<E>( m_Data );
+      return std::get<1>( m_Data );
     }
 
-    const T & operator*() const
+    E && GetError() &&
+    {
+      return std::get<1>( std::move( m_Data ) );
+    }
+
+    const T & operator*() const &
     {
       return GetValue();
     }
 
-    T & operator*()
+    T & operator*() &
     {
       return GetValue();
     }
 
+    const T * operator->() const
+    {
+      return &GetValue();
+    }
+
+    T * operator->()
+    {
+      return &GetValue();
+    }
+
+    template <typename U> [[nodiscard]] T ValueOr( U && fallback ) const &
+    {
+      return IsValid() ? GetValue() : static_cast<T>( std::forward<U>( fallback ) );
+    }
+
+    template <typename U> [[nodiscard]] T ValueOr( U && fallback ) &&
+    {
+      return IsValid() ? std::move( *this ).GetValue()
+                       : static_cast<T>( std::forward<U>( fallback ) );
+    }
+
+    // f( value ) returns the next Result; an error is passed through untouched.
+    template <typename F> auto AndThen( F && f ) const &
+    {
+      using Next = std::remove_cvref_t<std::invoke_result_t<F, const T &>>;
+      if ( IsValid() )
+      {
+        return std::invoke( std::forward<F>( f ), GetValue() );
+      }
+
+      return Next( GetError() );
+    }
+
+    template <typename F> auto AndThen( F && f ) &&
+    {
+      using Next = std::remove_cvref_t<std::invoke_result_t<F, T &&>>;
+      if ( IsValid() )
+      {
+        return std::invoke( std::forward<F>( f ), std::move( *this ).GetValue() );
+      }
+
+      return Next( std::move( *this ).GetError() );
+    }
+
+    // f( value ) returns a plain value, which is wrapped in a Result.
+    template <typename F> auto Transform( F && f ) const &
+    {
+      using U = std::remove_cvref_t<std::invoke_result_t<F, const T &>>;
+      if ( IsValid() )
+      {
+        return Result<U, E>( std::invoke( std::forward<F>( f ), GetValue() ) );
+      }
+
+      return Result<U, E>( GetError() );
+    }
+
+    template <typename F> auto Transform( F && f ) &&
+    {
+      using U = std::remove_cvref_t<std::invoke_result_t<F, T &&>>;
+      if ( IsValid() )
+      {
+        return Result<U, E>(
+          std::invoke( std::forward<F>( f ), std::move( *this ).GetValue() ) );
+      }
+
+      return Result<U, E>( std::move( *this ).GetError() );
+    }
+
+    // f( error ) returns a Result to recover with; a value is passed through.
+    template <typename F> auto OrElse( F && f ) const &
+    {
+      using Next = std::remove_cvref_t<std::invoke_result_t<F, const E &>>;
+      if ( IsValid() )
+      {
+        return Next( GetValue() );
+      }
+
+      return std::invoke( std::forward<F>( f ), GetError() );
+    }
+
+    template <typename F> auto OrElse( F && f ) &&
+    {
+      using Next = std::remove_cvref_t<std::invoke_result_t<F, E &&>>;
+      if ( IsValid() )
+      {
+        return Next( std::move( *this ).GetValue() );
+      }
+
+      return std::invoke( std::forward<F>( f ), std::move( *this ).GetError() );
+    }
+
   private:
-    std::variant<T, E> m_Data = {};
+    std::variant<T, E> m_Data;
   };
+
+  static_assert( std::is_trivially_copyable_v<Result<u32>> );
 } // namespace Engine
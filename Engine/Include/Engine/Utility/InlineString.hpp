@@ -0,0 +1,221 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+#include <format>
+#include <span>
+#include <string_view>
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Utility::String
+{
+  // Length of str without a trailing UTF-8 sequence that is cut short.
+  size CompleteUtf8Length( std::string_view str );
+
+  // Appends what fits of str after the first `length` bytes of buffer and returns
+  // the new length.  A cut never splits a UTF-8 sequence and sets isTruncated;
+  // once it is set nothing more is appended, so the text never has a gap.
+  size AppendTruncated( std::span<c8> buffer, size length, std::string_view str,
+                        bool & isTruncated );
+
+  template <typename... Args>
+  size FormatTruncated( const std::span<c8> buffer, const size length,
+                        bool & isTruncated, std::format_string<Args...> fmt,
+                        Args &&... args )
+  {
+    if ( isTruncated )
+    {
+      return length;
+    }
+
+    const auto Remaining = buffer.size() - length;
+    const auto Result    = std::format_to_n(
+      buffer.data() + length, static_cast<std::ptrdiff_t>( Remaining ), fmt,
+      std::forward<Args>( args )... );
+    if ( static_cast<size>( Result.size ) <= Remaining )
+    {
+      return length + static_cast<size>( Result.size );
+    }
+
+    isTruncated = true;
+    return length + CompleteUtf8Length( { buffer.data() + length, Remaining } );
+  }
+} // namespace Engine::Utility::String
+
+namespace Engine::Utility
+{
+  // A null-terminated string stored entirely inside the object.  Text past the
+  // capacity is dropped rather than allocated, and IsTruncated() reports it.
+  template <size N> class InlineString
+  {
+  public:
+    InlineString()
+    {
+      m_Data[ 0 ] = 0;
+    }
+
+    explicit InlineString( const std::string_view str )
+      : InlineString()
+    {
+      Append( str );
+    }
+
+    void Append( const std::string_view str )
+    {
+      m_Length = String::AppendTruncated( { m_Data.data(), N }, m_Length, str,
+                                          m_IsTruncated );
+      m_Data[ m_Length ] = 0;
+    }
+
+    template <typename... Args>
+    void AppendFormat( std::format_string<Args...> fmt, Args &&... args )
+    {
+      m_Length = String::FormatTruncated( { m_Data.data(), N }, m_Length,
+                                          m_IsTruncated, fmt,
+                                          std::forward<Args>( args )... );
+      m_Data[ m_Length ] = 0;
+    }
+
+    void Clear()
+    {
+      m_Length      = 0;
+      m_IsTruncated = false;
+      m_Data[ 0 ]   = 0;
+    }
+
+    [[nodiscard]] std::string_view View() const
+    {
+      return { m_Data.data(), m_Length };
+    }
+
+    [[nodiscard]] const c8 * CStr() const
+    {
+      return m_Data.data();
+    }
+
+    [[nodiscard]] size GetLength() const
+    {
+      return m_Length;
+    }
+
+    [[nodiscard]] static constexpr size GetCapacity()
+    {
+      return N;
+    }
+
+    [[nodiscard]] bool IsTruncated() const
+    {
+      return m_IsTruncated;
+    }
+
+    operator std::string_view() const
+    {
+      return View();
+    }
+
+  private:
+    // Only the used part and its terminator are ever written.
+    std::array<c8, N + 1> m_Data;
+    size                  m_Length      = 0;
+    bool                  m_IsTruncated = false;
+  };
+
+  // Builds a null-terminated string in memory it does not own, such as a stack
+  // buffer or a block from a frame allocator.  Like InlineString, it never
+  // allocates and drops whatever does not fit.
+  class StringBuilder
+  {
+  public:
+    // The last byte of the buffer is kept for the terminator, so it must not be
+    // empty.
+    explicit StringBuilder( std::span<c8> buffer );
+
+    void Append( std::string_view str );
+
+    template <typename... Args>
+    void AppendFormat( std::format_string<Args...> fmt, Args &&... args )
+    {
+      m_Length = String::FormatTruncated( GetWritable(), m_Length, m_IsTruncated,
+                                          fmt, std::forward<Args>( args )... );
+      m_Buffer[ m_Length ] = 0;
+    }
+
+    void Clear();
+
+    [[nodiscard]] std::string_view View() const
+    {
+      return { m_Buffer.data(), m_Length };
+    }
+
+    [[nodiscard]] const c8 * CStr() const
+    {
+      return m_Buffer.data();
+    }
+
+    [[nodiscard]] size GetLength() const
+    {
+      return m_Length;
+    }
+
+    [[nodiscard]] size GetCapacity() const
+    {
+      return m_Buffer.size() - 1;
+    }
+
+    [[nodiscard]] bool IsTruncated() const
+    {
+      return m_IsTruncated;
+    }
+
+  private:
+    [[nodiscard]] std::span<c8> GetWritable() const
+    {
+      return m_Buffer.first( GetCapacity() );
+    }
+
+    std::span<c8> m_Buffer;
+    size          m_Length      = 0;
+    bool          m_IsTruncated = false;
+  };
+} // namespace Engine::Utility
+
+namespace Engine::Utility::String
+{
+  // Formats without touching the heap: Format<64>( ... ) returns the text inline,
+  // and the other overloads append to an existing string or builder.
+  template <size N, typename... Args>
+  InlineString<N> Format( std::format_string<Args...> fmt, Args &&... args )
+  {
+    InlineString<N> str;
+    str.AppendFormat( fmt, std::forward<Args>( args )... );
+    return str;
+  }
+
+  template <size N, typename... Args>
+  std::string_view Format( InlineString<N> & str, std::format_string<Args...> fmt,
+                           Args &&... args )
+  {
+    str.AppendFormat( fmt, std::forward<Args>( args )... );
+    return str.View();
+  }
+
+  template <typename... Args>
+  std::string_view Format( StringBuilder & builder, std::format_string<Args...> fmt,
+                           Args &&... args )
+  {
+    builder.AppendFormat( fmt, std::forward<Args>( args )... );
+    return builder.View();
+  }
+} // namespace Engine::Utility::String
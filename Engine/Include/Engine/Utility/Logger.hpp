@@ -12,13 +12,26 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <format>
+#include <memory>
+#include <mutex>
 #include <source_location>
+#include <span>
+#include <vector>
 
 #include "Engine/Core/Types.hpp"
+#include "Engine/Utility/Logging/LogArgs.hpp"
+#include "Engine/Utility/Logging/LogClock.hpp"
+#include "Engine/Utility/Logging/LogSiteState.hpp"
 
 namespace Engine::Utility
 {
+  struct LogRecord;
+  class AsyncLogWriter;
+  class LogSink;
+
   class Logger
   {
   public:
@@ -31,6 +44,28 @@ namespace Engine::Utility
       m_Fatal,
     };
 
+    // Each channel has its own runtime severity.  LOG_* macros log to m_Default;
+    // LOG_*_CH( Renderer, ... ) names the channel explicitly.
+    enum class LogChannel : u8
+    {
+      m_Core,
+      m_Platform,
+      m_Events,
+      m_Renderer,
+      m_Game,
+
+      m_Default = m_Core,
+    };
+
+    static constexpr size s_ChannelCount = 5;
+
+    enum class LogOverflowPolicy : u8
+    {
+      m_Block,
+      m_Drop,
+      m_DropAndCount,
+    };
+
     struct SourceInfo
     {
       u16          m_Line          = 0;
@@ -51,116 +86,416 @@ namespace Engine::Utility
       std::string      m_FormattedMessage = {};
     };
 
+    struct AsyncConfig
+    {
+      u32               m_Capacity       = 8192;
+      u32               m_BatchSize      = 256;
+      LogOverflowPolicy m_OverflowPolicy = LogOverflowPolicy::m_Block;
+
+      // Trivially copyable and string arguments are packed as raw bytes and
+      // formatted on the writer thread.
+      bool m_IsFormattingDeferred = true;
+    };
+
+    // Applies to every channel.
     static void SetSeverity( LogSeverity severity );
+    static void SetSeverity( LogChannel channel, LogSeverity severity );
+
+    [[nodiscard]] static LogSeverity GetSeverity( LogChannel channel );
+
+    // Records at or above this severity reach the flight recorder even when the
+    // sinks filter them out.
+    static void SetCaptureSeverity( LogSeverity severity );
+
+    [[nodiscard]] static bool IsEnabled( const LogChannel  channel,
+                                         const LogSeverity severity )
+    {
+      return severity >= s_ChannelSeverities[ static_cast<size>( channel ) ].load(
+                           std::memory_order_relaxed );
+    }
     static void Log( const LogMetadata & metadata, const LogMessage & message );
 
+    // #NOTE: Not thread-safe against concurrent logging; call during startup and
+    //        shutdown only.
+    static void AddSink( std::shared_ptr<LogSink> pSink );
+    static void RemoveSink( const std::shared_ptr<LogSink> & pSink );
+    static void ClearSinks();
+
+    // #NOTE: Like the sink calls, must not race with logging; StopAsync destroys
+    //        the writer other threads push to.  Call during startup and
+    //        shutdown only.
+    static void StartAsync( const AsyncConfig & config );
+    static void StopAsync();
+    static void Flush();
+
+    [[nodiscard]] static bool IsAsync();
+
+    struct LogSite
+    {
+      SourceInfo       m_SourceInfo = {};
+      LogSeverity      m_Severity   = {};
+      LogChannel       m_Channel    = {};
+      std::string_view m_Format     = {};
+
+      static constexpr LogSite Make( const std::source_location & loc,
+                                     const LogSeverity           severity,
+                                     const LogChannel            channel,
+                                     const std::string_view      format )
+      {
+        return { { static_cast<u16>( loc.line() ), loc.file_name(),
+                   loc.function_name() },
+                 severity,
+                 channel,
+                 format };
+      }
+    };
+
     template <typename... Args>
-    static void Log( const std::source_location & loc, const LogSeverity severity,
-                     std::string_view fmt, Args &&... args )
+    static void Log( const LogSite & site, std::format_string<Args...> fmt,
+                     Args &&... args )
     {
-      if ( severity < s_LogSeverity )
+      const auto isSeverityEnabled =
+        IsEnabled( site.m_Channel, site.m_Severity );
+
+      // Cleared once the flight recorder holds a copy.
+      auto isCapturePending =
+        site.m_Severity >= s_CaptureSeverity.load( std::memory_order_relaxed );
+
+      if ( !isSeverityEnabled && !isCapturePending )
       {
         return;
       }
 
-      LogMetadata meta                  = {};
-      meta.m_SourceInfo.m_Line          = static_cast<u16>( loc.line() );
-      meta.m_SourceInfo.m_pFileName     = loc.file_name();
-      meta.m_SourceInfo.m_pFunctionName = loc.function_name();
-      meta.m_Severity                   = severity;
-      meta.m_IsVerbose                  = true;
+      const auto Tick = LogClock::Now();
 
-      LogMessage message = {};
-      message.m_Format   = fmt;
-
-      if constexpr ( sizeof...( args ) > 0 )
+      if constexpr ( ( DeferrableLogArg<std::decay_t<Args>> && ... ) )
       {
-        try
-        {
-          const std::string FmtStr( fmt );
-          message.m_FormattedMessage =
-            std::vformat( FmtStr, std::make_format_args( args... ) );
-        }
-        catch ( const std::format_error & e )
+        LogPayload payload;
+        if ( EncodeLogArgs<std::decay_t<Args>...>( payload, args... ) )
         {
-          message.m_FormattedMessage =
-            std::format( "[FORMAT ERROR: {}] Raw format: {}", e.what(), fmt );
+          const auto & Codec = LogCodecFor<std::decay_t<Args>...>::s_Codec;
+
+          if ( isCapturePending )
+          {
+            Capture( site, Codec, Tick, payload );
+            isCapturePending = false;
+          }
+
+          if ( isSeverityEnabled &&
+               s_IsFormattingDeferred.load( std::memory_order_relaxed ) )
+          {
+            LogDeferred( site, Tick, Codec, payload );
+            return;
+          }
         }
-        catch ( ... )
+      }
+
+      if ( !isSeverityEnabled )
+      {
+        // Not worth formatting just for the recorder; it keeps the site only.
+        if ( isCapturePending )
         {
-          message.m_FormattedMessage =
-            std::format( "[UNKNOWN FORMAT ERROR] Raw format: {}", fmt );
+          Capture( site, Tick, {} );
         }
+        return;
       }
-      else
+
+      auto message = std::format( fmt, std::forward<Args>( args )... );
+
+      if ( isCapturePending )
       {
-        message.m_FormattedMessage = std::string( fmt );
+        Capture( site, Tick, message );
       }
 
-      Log( meta, message );
+      LogFormatted( site, Tick, std::move( message ) );
     }
 
     template <typename... Args>
-    static void TraceImpl( const std::source_location & loc, std::string_view fmt,
+    static void TraceImpl( const LogSite & site, std::format_string<Args...> fmt,
                            Args &&... args )
     {
-      Log( loc, LogSeverity::m_Trace, fmt, std::forward<Args>( args )... );
+      Log( site, fmt, std::forward<Args>( args )... );
     }
 
     template <typename... Args>
-    static void InfoImpl( const std::source_location & loc, std::string_view fmt,
+    static void InfoImpl( const LogSite & site, std::format_string<Args...> fmt,
                           Args &&... args )
     {
-      Log( loc, LogSeverity::m_Info, fmt, std::forward<Args>( args )... );
+      Log( site, fmt, std::forward<Args>( args )... );
     }
 
     template <typename... Args>
-    static void WarnImpl( const std::source_location & loc, std::string_view fmt,
+    static void WarnImpl( const LogSite & site, std::format_string<Args...> fmt,
                           Args &&... args )
     {
-      Log( loc, LogSeverity::m_Warn, fmt, std::forward<Args>( args )... );
+      Log( site, fmt, std::forward<Args>( args )... );
     }
 
     template <typename... Args>
-    static void ErrorImpl( const std::source_location & loc, std::string_view fmt,
+    static void ErrorImpl( const LogSite & site, std::format_string<Args...> fmt,
                            Args &&... args )
     {
-      Log( loc, LogSeverity::m_Error, fmt, std::forward<Args>( args )... );
+      Log( site, fmt, std::forward<Args>( args )... );
     }
 
     template <typename... Args>
-    static void FatalImpl( const std::source_location & loc, std::string_view fmt,
+    static void FatalImpl( const LogSite & site, std::format_string<Args...> fmt,
                            Args &&... args )
     {
-      Log( loc, LogSeverity::m_Fatal, fmt, std::forward<Args>( args )... );
+      Log( site, fmt, std::forward<Args>( args )... );
+      Terminate();
+    }
+
+    // Emits a summary for messages a rate-limited call site dropped since it
+    // last logged.
+    static void ReportSuppressed( const LogSite & site, LogSiteState & state )
+    {
+      if ( const auto Count = state.TakeSuppressedCount(); Count > 0 )
+      {
+        LogFormatted( site, LogClock::Now(),
+                      std::format( "Suppressed {} messages", Count ) );
+      }
+    }
+
+    // Remembers a site that started suppressing, so its count is reported once
+    // the burst ends even if the site never logs again.
+    static void QueueSuppressedSummary( const LogSite & site, LogSiteState & state );
+
+    [[nodiscard]] static bool HasPendingSummaries()
+    {
+      return s_HasPendingSummaries.load( std::memory_order_relaxed );
+    }
+
+    // Appends a summary record for every queued site whose rate-limit window
+    // has closed, or for every queued site when isForced.  Called by the
+    // writer thread and by Flush.
+    static void CollectSuppressedSummaries( std::vector<LogRecord> & records,
+                                            bool                     isForced );
 
-      std::abort();
+    // Target of compiled-out macros; keeps the format string checked without
+    // evaluating any arguments.
+    template <typename... Args>
+    static constexpr void DiscardImpl( std::format_string<Args...>, Args &&... )
+    {
     }
 
   private:
-    static void LogImpl( const LogMetadata & metadata, const LogMessage & message );
+    struct PendingSummary
+    {
+      const LogSite * m_pSite  = nullptr;
+      LogSiteState *  m_pState = nullptr;
+    };
+
+    [[nodiscard]] static LogRecord MakeRecord( const LogSite & site, u64 tick,
+                                               std::string && message );
+    static void LogFormatted( const LogSite & site, u64 tick,
+                              std::string && message );
+    static void EmitSuppressedSummaries();
+    static void LogDeferred( const LogSite & site, u64 tick,
+                             const LogCodec & codec, const LogPayload & payload );
+    static void Capture( const LogSite & site, const LogCodec & codec, u64 tick,
+                         const LogPayload & payload );
+    static void Capture( const LogSite & site, u64 tick, std::string_view message );
+    static void Dispatch( LogRecord && record );
+    static void LogImpl( const LogRecord & record );
+    static void WriteRecords( std::span<const LogRecord> records );
+    static void FlushSinks();
+
+    // Flushes, dumps the flight recorder, breaks into the debugger and aborts.
+    [[noreturn]] static void Terminate();
+
+    static std::array<std::atomic<LogSeverity>, s_ChannelCount> s_ChannelSeverities;
 
-    static LogSeverity s_LogSeverity;
-    static bool        s_IsDebugBreakEnabled;
+    static std::atomic<LogSeverity>        s_CaptureSeverity;
+    static std::atomic<bool>               s_IsFormattingDeferred;
+    static std::unique_ptr<AsyncLogWriter> s_pAsyncWriter;
+
+    static std::mutex                            s_SinkMutex;
+    static std::vector<std::shared_ptr<LogSink>> s_Sinks;
+
+    static std::mutex                  s_SummaryMutex;
+    static std::vector<PendingSummary> s_PendingSummaries;
+    static std::atomic<bool>           s_HasPendingSummaries;
   };
 } // namespace Engine::Utility
 
-#define LOG_TRACE( fmt, ... )                                                       \
-  Engine::Utility::Logger::TraceImpl( std::source_location::current(), fmt,         \
-                                      ##__VA_ARGS__ )
+#define TRIUMPH_LOG_LEVEL_TRACE 0
+#define TRIUMPH_LOG_LEVEL_INFO  1
+#define TRIUMPH_LOG_LEVEL_WARN  2
+#define TRIUMPH_LOG_LEVEL_ERROR 3
+#define TRIUMPH_LOG_LEVEL_FATAL 4
+
+#if !defined( TRIUMPH_LOG_MIN_LEVEL )
+#define TRIUMPH_LOG_MIN_LEVEL TRIUMPH_LOG_LEVEL_TRACE
+#endif
+
+static_assert( TRIUMPH_LOG_LEVEL_FATAL ==
+               static_cast<int>( Engine::Utility::Logger::LogSeverity::m_Fatal ) );
+
+#define TRIUMPH_LOG( impl, severity, channel, fmt, ... )                            \
+  do                                                                                \
+  {                                                                                 \
+    static constexpr auto s_TriumphLogSite =                                        \
+      Engine::Utility::Logger::LogSite::Make(                                       \
+        std::source_location::current(),                                            \
+        Engine::Utility::Logger::LogSeverity::severity,                             \
+        Engine::Utility::Logger::LogChannel::m_##channel, fmt );                    \
+    Engine::Utility::Logger::impl( s_TriumphLogSite, fmt, ##__VA_ARGS__ );          \
+  }                                                                                 \
+  while ( false )
+
+#define TRIUMPH_LOG_DISCARD( fmt, ... )                                             \
+  do                                                                                \
+  {                                                                                 \
+    if constexpr ( false )                                                          \
+    {                                                                               \
+      Engine::Utility::Logger::DiscardImpl( fmt, ##__VA_ARGS__ );                   \
+    }                                                                               \
+  }                                                                                 \
+  while ( false )
+
+#define TRIUMPH_LOG_IF( impl, severity, channel, condition, fmt, ... )              \
+  do                                                                                \
+  {                                                                                 \
+    static constexpr auto s_TriumphLogSite =                                        \
+      Engine::Utility::Logger::LogSite::Make(                                       \
+        std::source_location::current(),                                            \
+        Engine::Utility::Logger::LogSeverity::severity,                             \
+        Engine::Utility::Logger::LogChannel::m_##channel, fmt );                    \
+    static constinit Engine::Utility::LogSiteState s_TriumphLogState;               \
+    if ( Engine::Utility::Logger::IsEnabled( s_TriumphLogSite.m_Channel,            \
+                                             s_TriumphLogSite.m_Severity ) )        \
+    {                                                                               \
+      if ( s_TriumphLogState.condition )                                            \
+      {                                                                             \
+        Engine::Utility::Logger::ReportSuppressed( s_TriumphLogSite,                \
+                                                   s_TriumphLogState );             \
+        Engine::Utility::Logger::impl( s_TriumphLogSite, fmt, ##__VA_ARGS__ );      \
+      }                                                                             \
+      else if ( s_TriumphLogState.TryQueueSummary() )                               \
+      {                                                                             \
+        Engine::Utility::Logger::QueueSuppressedSummary( s_TriumphLogSite,          \
+                                                         s_TriumphLogState );       \
+      }                                                                             \
+    }                                                                               \
+  }                                                                                 \
+  while ( false )
+
+#if TRIUMPH_LOG_MIN_LEVEL <= TRIUMPH_LOG_LEVEL_TRACE
+#define LOG_TRACE_CH( channel, fmt, ... )                                           \
+  TRIUMPH_LOG( TraceImpl, m_Trace, channel, fmt, ##__VA_ARGS__ )
+#define LOG_TRACE_ONCE_CH( channel, fmt, ... )                                      \
+  TRIUMPH_LOG_IF( TraceImpl, m_Trace, channel, ShouldLogOnce(), fmt,                \
+                  ##__VA_ARGS__ )
+#define LOG_TRACE_EVERY_N_CH( channel, n, fmt, ... )                                \
+  TRIUMPH_LOG_IF( TraceImpl, m_Trace, channel, ShouldLogEveryN( n ), fmt,           \
+                  ##__VA_ARGS__ )
+#define LOG_TRACE_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                   \
+  TRIUMPH_LOG_IF( TraceImpl, m_Trace, channel, ShouldLogRateLimited( perSecond ),   \
+                  fmt, ##__VA_ARGS__ )
+#else
+#define LOG_TRACE_CH( channel, fmt, ... ) TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_TRACE_ONCE_CH( channel, fmt, ... )                                      \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_TRACE_EVERY_N_CH( channel, n, fmt, ... )                                \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_TRACE_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                   \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#endif
+
+#define LOG_TRACE( fmt, ... ) LOG_TRACE_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_TRACE_ONCE( fmt, ... ) LOG_TRACE_ONCE_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_TRACE_EVERY_N( n, fmt, ... )                                            \
+  LOG_TRACE_EVERY_N_CH( Default, n, fmt, ##__VA_ARGS__ )
+#define LOG_TRACE_RATE_LIMITED( perSecond, fmt, ... )                               \
+  LOG_TRACE_RATE_LIMITED_CH( Default, perSecond, fmt, ##__VA_ARGS__ )
+
+#if TRIUMPH_LOG_MIN_LEVEL <= TRIUMPH_LOG_LEVEL_INFO
+#define LOG_INFO_CH( channel, fmt, ... )                                            \
+  TRIUMPH_LOG( InfoImpl, m_Info, channel, fmt, ##__VA_ARGS__ )
+#define LOG_INFO_ONCE_CH( channel, fmt, ... )                                       \
+  TRIUMPH_LOG_IF( InfoImpl, m_Info, channel, ShouldLogOnce(), fmt, ##__VA_ARGS__ )
+#define LOG_INFO_EVERY_N_CH( channel, n, fmt, ... )                                 \
+  TRIUMPH_LOG_IF( InfoImpl, m_Info, channel, ShouldLogEveryN( n ), fmt,             \
+                  ##__VA_ARGS__ )
+#define LOG_INFO_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                    \
+  TRIUMPH_LOG_IF( InfoImpl, m_Info, channel, ShouldLogRateLimited( perSecond ),     \
+                  fmt, ##__VA_ARGS__ )
+#else
+#define LOG_INFO_CH( channel, fmt, ... ) TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_INFO_ONCE_CH( channel, fmt, ... )                                       \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_INFO_EVERY_N_CH( channel, n, fmt, ... )                                 \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_INFO_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                    \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#endif
+
+#define LOG_INFO( fmt, ... ) LOG_INFO_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_INFO_ONCE( fmt, ... ) LOG_INFO_ONCE_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_INFO_EVERY_N( n, fmt, ... )                                             \
+  LOG_INFO_EVERY_N_CH( Default, n, fmt, ##__VA_ARGS__ )
+#define LOG_INFO_RATE_LIMITED( perSecond, fmt, ... )                                \
+  LOG_INFO_RATE_LIMITED_CH( Default, perSecond, fmt, ##__VA_ARGS__ )
+
+#if TRIUMPH_LOG_MIN_LEVEL <= TRIUMPH_LOG_LEVEL_WARN
+#define LOG_WARN_CH( channel, fmt, ... )                                            \
+  TRIUMPH_LOG( WarnImpl, m_Warn, channel, fmt, ##__VA_ARGS__ )
+#define LOG_WARN_ONCE_CH( channel, fmt, ... )                                       \
+  TRIUMPH_LOG_IF( WarnImpl, m_Warn, channel, ShouldLogOnce(), fmt, ##__VA_ARGS__ )
+#define LOG_WARN_EVERY_N_CH( channel, n, fmt, ... )                                 \
+  TRIUMPH_LOG_IF( WarnImpl, m_Warn, channel, ShouldLogEveryN( n ), fmt,             \
+                  ##__VA_ARGS__ )
+#define LOG_WARN_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                    \
+  TRIUMPH_LOG_IF( WarnImpl, m_Warn, channel, ShouldLogRateLimited( perSecond ),     \
+                  fmt, ##__VA_ARGS__ )
+#else
+#define LOG_WARN_CH( channel, fmt, ... ) TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_WARN_ONCE_CH( channel, fmt, ... )                                       \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_WARN_EVERY_N_CH( channel, n, fmt, ... )                                 \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_WARN_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                    \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#endif
 
-#define LOG_INFO( fmt, ... )                                                        \
-  Engine::Utility::Logger::InfoImpl( std::source_location::current(), fmt,          \
-                                     ##__VA_ARGS__ )
+#define LOG_WARN( fmt, ... ) LOG_WARN_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_WARN_ONCE( fmt, ... ) LOG_WARN_ONCE_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_WARN_EVERY_N( n, fmt, ... )                                             \
+  LOG_WARN_EVERY_N_CH( Default, n, fmt, ##__VA_ARGS__ )
+#define LOG_WARN_RATE_LIMITED( perSecond, fmt, ... )                                \
+  LOG_WARN_RATE_LIMITED_CH( Default, perSecond, fmt, ##__VA_ARGS__ )
 
-#define LOG_WARN( fmt, ... )                                                        \
-  Engine::Utility::Logger::WarnImpl( std::source_location::current(), fmt,          \
-                                     ##__VA_ARGS__ )
+#if TRIUMPH_LOG_MIN_LEVEL <= TRIUMPH_LOG_LEVEL_ERROR
+#define LOG_ERROR_CH( channel, fmt, ... )                                           \
+  TRIUMPH_LOG( ErrorImpl, m_Error, channel, fmt, ##__VA_ARGS__ )
+#define LOG_ERROR_ONCE_CH( channel, fmt, ... )                                      \
+  TRIUMPH_LOG_IF( ErrorImpl, m_Error, channel, ShouldLogOnce(), fmt,                \
+                  ##__VA_ARGS__ )
+#define LOG_ERROR_EVERY_N_CH( channel, n, fmt, ... )                                \
+  TRIUMPH_LOG_IF( ErrorImpl, m_Error, channel, ShouldLogEveryN( n ), fmt,           \
+                  ##__VA_ARGS__ )
+#define LOG_ERROR_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                   \
+  TRIUMPH_LOG_IF( ErrorImpl, m_Error, channel, ShouldLogRateLimited( perSecond ),   \
+                  fmt, ##__VA_ARGS__ )
+#else
+#define LOG_ERROR_CH( channel, fmt, ... ) TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_ERROR_ONCE_CH( channel, fmt, ... )                                      \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_ERROR_EVERY_N_CH( channel, n, fmt, ... )                                \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#define LOG_ERROR_RATE_LIMITED_CH( channel, perSecond, fmt, ... )                   \
+  TRIUMPH_LOG_DISCARD( fmt, ##__VA_ARGS__ )
+#endif
 
-#define LOG_ERROR( fmt, ... )                                                       \
-  Engine::Utility::Logger::ErrorImpl( std::source_location::current(), fmt,         \
-                                      ##__VA_ARGS__ )
+#define LOG_ERROR( fmt, ... ) LOG_ERROR_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_ERROR_ONCE( fmt, ... ) LOG_ERROR_ONCE_CH( Default, fmt, ##__VA_ARGS__ )
+#define LOG_ERROR_EVERY_N( n, fmt, ... )                                            \
+  LOG_ERROR_EVERY_N_CH( Default, n, fmt, ##__VA_ARGS__ )
+#define LOG_ERROR_RATE_LIMITED( perSecond, fmt, ... )                               \
+  LOG_ERROR_RATE_LIMITED_CH( Default, perSecond, fmt, ##__VA_ARGS__ )
 
-#define LOG_FATAL( fmt, ... )                                                       \
-  Engine::Utility::Logger::FatalImpl( std::source_location::current(), fmt,         \
-                                      ##__VA_ARGS__ )
+// #NOTE: Never compiled out; FATAL terminates the process.
+#define LOG_FATAL_CH( channel, fmt, ... )                                           \
+  TRIUMPH_LOG( FatalImpl, m_Fatal, channel, fmt, ##__VA_ARGS__ )
+#define LOG_FATAL( fmt, ... ) LOG_FATAL_CH( Default, fmt, ##__VA_ARGS__ )
@@ -0,0 +1,64 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <atomic>
+#include <span>
+#include <thread>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Types.hpp"
+#include "Engine/Utility/Logger.hpp"
+#include "Engine/Utility/Logging/LogQueue.hpp"
+
+namespace Engine::Utility
+{
+  class AsyncLogWriter
+  {
+    DISALLOW_COPY( AsyncLogWriter );
+    DISALLOW_MOVE( AsyncLogWriter );
+
+  public:
+    using WriteCallback = void ( * )( std::span<const LogRecord> records );
+    using FlushCallback = void ( * )();
+
+    // onIdle runs on the writer thread whenever the queue drains after a write.
+    AsyncLogWriter( const Logger::AsyncConfig & config, WriteCallback callback,
+                    FlushCallback onIdle );
+    ~AsyncLogWriter();
+
+    void Push( LogRecord && record );
+    void Flush();
+
+    [[nodiscard]] u64 GetDroppedCount() const;
+
+  private:
+    void Run();
+    void Wake();
+
+    LogQueue                  m_Queue;
+    WriteCallback             m_pWriteCallback;
+    FlushCallback             m_pIdleCallback;
+    Logger::LogOverflowPolicy m_OverflowPolicy;
+    u32                       m_BatchSize;
+
+    std::atomic<u64>  m_EnqueuedCount;
+    std::atomic<u64>  m_WrittenCount;
+    std::atomic<u64>  m_DroppedCount;
+    std::atomic<u64>  m_TotalDroppedCount;
+    std::atomic<u32>  m_Signal;
+    std::atomic<bool> m_IsRunning;
+
+    std::thread m_Thread;
+  };
+} // namespace Engine::Utility
@@ -0,0 +1,76 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <span>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Utility/Logging/LogArgs.hpp"
+#include "Engine/Utility/Logging/LogSink.hpp"
+
+namespace Engine::Utility
+{
+  // Writes records in the format described in BinaryLogFormat.hpp.  Packed
+  // arguments are copied as-is and never formatted in-process; the
+  // TriumphLogDecode tool turns the file back into text or JSON lines.
+  class BinaryFileSink final : public LogSink
+  {
+  public:
+    explicit BinaryFileSink(
+      const std::filesystem::path & path,
+      Logger::LogSeverity           severity = Logger::LogSeverity::m_Trace );
+    ~BinaryFileSink() override;
+
+    void Write( const LogRecord & record, std::string_view message ) override;
+    void Flush() override;
+
+    [[nodiscard]] bool IsMessageRequired() const override;
+    [[nodiscard]] bool IsOpen() const;
+
+  private:
+    static constexpr size s_FlushThreshold = 64 * 1024;
+
+    struct SiteIds
+    {
+      u32 m_TextId   = 0;
+      u32 m_RecordId = 0;
+    };
+
+    using MetadataKey =
+      std::tuple<const char *, const char *, u16, Logger::LogSeverity>;
+
+    u32 GetSiteId( const LogRecord & record, bool isPacked );
+    u32 DefineSite( const Logger::SourceInfo &  sourceInfo,
+                    Logger::LogSeverity         severity,
+                    std::string_view            format,
+                    std::span<const LogArgType> argTypes );
+
+    template <typename T> void Put( const T & value );
+    void                       PutBytes( const void * pData, size length );
+    void                       PutString( std::string_view text );
+
+    std::ofstream          m_File;
+    std::vector<std::byte> m_Buffer;
+    std::string            m_Scratch;
+
+    std::unordered_map<const Logger::LogSite *, SiteIds> m_Sites;
+    std::map<MetadataKey, u32>                           m_MetadataSites;
+    u32                                                  m_NextSiteId;
+  };
+} // namespace Engine::Utility
@@ -0,0 +1,78 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <bit>
+#include <chrono>
+
+#include "Engine/Core/Types.hpp"
+#include "Engine/Utility/Logging/LogClock.hpp"
+
+namespace Engine::Utility
+{
+  // A binary log is a BinaryLogHeader followed by a stream of entries, each
+  // starting with a BinaryLogEntry tag.  Integers are little-endian and
+  // unaligned; strings are a u32 byte length followed by UTF-8 bytes.
+  //
+  //   m_Site    u32 id, u8 severity, u16 line, u8 arg count, u8 arg types[],
+  //             string file, string function, string format
+  //   m_Record  u32 site id, u32 thread id, u64 tick, u16 payload size,
+  //             payload bytes packed as by EncodeLogArgs
+  //   m_Text    u32 site id, u32 thread id, u64 tick, string message
+  //
+  // A site is written once, before the first entry that references it.
+  // m_Text carries records whose arguments could not be packed.
+  enum class BinaryLogEntry : u8
+  {
+    m_Site,
+    m_Record,
+    m_Text,
+  };
+
+  struct BinaryLogHeader
+  {
+    static constexpr u32 s_Magic   = 0x474C5254; // "TRLG"
+    static constexpr u16 s_Version = 1;
+
+    u32 m_Magic    = s_Magic;
+    u16 m_Version  = s_Version;
+    u16 m_Reserved = 0;
+
+    // Maps ticks onto the wall clock: m_AnchorTime (nanoseconds since the Unix
+    // epoch) corresponds to m_AnchorTick.
+    u64 m_TicksPerSecond = 0;
+    u64 m_AnchorTick     = 0;
+    i64 m_AnchorTime     = 0;
+
+    // Anchored at the current tick.
+    static BinaryLogHeader Make()
+    {
+      using Period = LogClock::Clock::period;
+
+      const auto Tick       = LogClock::Now();
+      const auto AnchorTime = LogClock::ToSystemTime( Tick ).time_since_epoch();
+
+      BinaryLogHeader header  = {};
+      header.m_TicksPerSecond = static_cast<u64>( Period::den / Period::num );
+      header.m_AnchorTick     = Tick;
+      header.m_AnchorTime =
+        std::chrono::duration_cast<std::chrono::nanoseconds>( AnchorTime ).count();
+
+      return header;
+    }
+  };
+
+  static_assert( sizeof( BinaryLogHeader ) == 32 );
+  static_assert( std::endian::native == std::endian::little,
+                 "The binary log format is little-endian" );
+} // namespace Engine::Utility
@@ -0,0 +1,35 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <string>
+
+#include "Engine/Utility/Logging/LogSink.hpp"
+
+namespace Engine::Utility
+{
+  class ConsoleSink final : public LogSink
+  {
+  public:
+    explicit ConsoleSink(
+      Logger::LogSeverity severity = Logger::LogSeverity::m_Trace );
+    ~ConsoleSink() override = default;
+
+    void Write( const LogRecord & record, std::string_view message ) override;
+    void EndBatch() override;
+    void Flush() override;
+
+  private:
+    std::string m_Buffer;
+  };
+} // namespace Engine::Utility
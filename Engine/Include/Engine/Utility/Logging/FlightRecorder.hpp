@@ -0,0 +1,64 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <string_view>
+
+#include "Engine/Utility/Logger.hpp"
+#include "Engine/Utility/Logging/LogArgs.hpp"
+
+namespace Engine::Utility
+{
+  // Always-on, per-thread ring of the most recent log records, kept in the packed
+  // argument layout regardless of the sink severity.  On a crash the rings are
+  // merged by tick and written as a binary log (see BinaryLogFormat.hpp) that
+  // TriumphLogDecode can read.
+  class FlightRecorder
+  {
+  public:
+    static constexpr u32 s_Capacity = 256;
+
+    // Lock-free; only the calling thread ever writes its ring.
+    static void Record( const Logger::LogSite & site, const LogCodec * pCodec,
+                        u64 tick, const LogPayload & payload );
+    // Keeps the leading bytes of an already formatted message.
+    static void Record( const Logger::LogSite & site, u64 tick,
+                        std::string_view message );
+
+    static void SetDumpPath( const std::filesystem::path & path );
+
+    // Only the first call writes anything, so it can be reached from both the
+    // fatal path and a signal handler.  Uses no heap memory.
+    static bool Dump();
+
+    // SIGSEGV, SIGABRT, SIGBUS, SIGFPE and SIGILL, or the unhandled exception
+    // filter on Windows.
+    static void InstallCrashHandlers();
+
+  private:
+    struct ThreadRing;
+    class RingLease;
+    class DumpWriter;
+
+    static ThreadRing & GetThreadRing();
+    static ThreadRing * AcquireRing();
+    static void         WriteDump( DumpWriter & writer );
+    static void         HandleSignal( int signal );
+
+    static std::atomic<ThreadRing *> s_pRings;
+    static std::atomic<bool>         s_IsDumped;
+    static std::filesystem::path     s_DumpPath;
+  };
+} // namespace Engine::Utility
@@ -0,0 +1,212 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Utility
+{
+  struct LogPayload
+  {
+    static constexpr size s_Capacity = 192;
+
+    // #NOTE: Left uninitialized on purpose; only the first m_Size bytes are
+    //        ever read.
+    std::array<std::byte, s_Capacity> m_Data;
+    u16                               m_Size = 0;
+  };
+
+  using LogDecodeFn = std::string ( * )( std::string_view format,
+                                         const std::byte * pData );
+
+  // Stable on-disk tags; append only.
+  enum class LogArgType : u8
+  {
+    m_Bool,
+    m_Char,
+    m_I8,
+    m_I16,
+    m_I32,
+    m_I64,
+    m_U8,
+    m_U16,
+    m_U32,
+    m_U64,
+    m_F32,
+    m_F64,
+    m_Pointer,
+    m_String,
+    m_Opaque,
+  };
+
+  // Describes how a deferred payload was packed so it can be formatted later,
+  // either in-process or offline from a binary log.
+  struct LogCodec
+  {
+    LogDecodeFn                 m_pDecode  = nullptr;
+    std::span<const LogArgType> m_ArgTypes = {};
+  };
+
+  template <typename T>
+  concept LogStringArg =
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+    std::is_same_v<T, const char *> || std::is_same_v<T, char *>;
+
+  template <typename T>
+  concept LogValueArg = std::is_trivially_copyable_v<T> && !LogStringArg<T>;
+
+  template <typename T>
+  concept DeferrableLogArg = LogStringArg<T> || LogValueArg<T>;
+
+  template <typename T>
+  using LogStoredArg = std::conditional_t<LogStringArg<T>, std::string_view, T>;
+
+  template <typename T> constexpr LogArgType GetLogArgType()
+  {
+    if constexpr ( LogStringArg<T> )
+    {
+      return LogArgType::m_String;
+    }
+    else if constexpr ( std::is_same_v<T, bool> )
+    {
+      return LogArgType::m_Bool;
+    }
+    else if constexpr ( std::is_same_v<T, c8> )
+    {
+      return LogArgType::m_Char;
+    }
+    else if constexpr ( std::is_same_v<T, std::nullptr_t> ||
+                        std::is_same_v<T, void *> ||
+                        std::is_same_v<T, const void *> )
+    {
+      return LogArgType::m_Pointer;
+    }
+    else if constexpr ( std::is_same_v<T, f32> )
+    {
+      return LogArgType::m_F32;
+    }
+    else if constexpr ( std::is_same_v<T, f64> )
+    {
+      return LogArgType::m_F64;
+    }
+    else if constexpr ( std::is_integral_v<T> && std::is_signed_v<T> )
+    {
+      constexpr LogArgType Types[] = { LogArgType::m_I8, LogArgType::m_I16,
+                                       LogArgType::m_I32, LogArgType::m_I64 };
+      return Types[ std::bit_width( sizeof( T ) ) - 1 ];
+    }
+    else if constexpr ( std::is_integral_v<T> )
+    {
+      constexpr LogArgType Types[] = { LogArgType::m_U8, LogArgType::m_U16,
+                                       LogArgType::m_U32, LogArgType::m_U64 };
+      return Types[ std::bit_width( sizeof( T ) ) - 1 ];
+    }
+    else
+    {
+      // Enums, user types with a formatter, wide characters, ...
+      return LogArgType::m_Opaque;
+    }
+  }
+
+  template <typename T> bool EncodeLogArg( LogPayload & payload, const T & arg )
+  {
+    if constexpr ( LogStringArg<T> )
+    {
+      const std::string_view View( arg );
+      const auto             Length = static_cast<u32>( View.length() );
+
+      if ( payload.m_Size + sizeof( Length ) + Length > LogPayload::s_Capacity )
+      {
+        return false;
+      }
+
+      std::memcpy( payload.m_Data.data() + payload.m_Size, &Length,
+                   sizeof( Length ) );
+      std::memcpy( payload.m_Data.data() + payload.m_Size + sizeof( Length ),
+                   View.data(), Length );
+      payload.m_Size += static_cast<u16>( sizeof( Length ) + Length );
+    }
+    else
+    {
+      if ( payload.m_Size + sizeof( T ) > LogPayload::s_Capacity )
+      {
+        return false;
+      }
+
+      std::memcpy( payload.m_Data.data() + payload.m_Size, &arg, sizeof( T ) );
+      payload.m_Size += static_cast<u16>( sizeof( T ) );
+    }
+
+    return true;
+  }
+
+  template <typename... Args>
+  bool EncodeLogArgs( LogPayload & payload, const Args &... args )
+  {
+    return ( EncodeLogArg<Args>( payload, args ) && ... );
+  }
+
+  template <typename T> LogStoredArg<T> DecodeLogArg( const std::byte *& pData )
+  {
+    if constexpr ( LogStringArg<T> )
+    {
+      u32 length = 0;
+      std::memcpy( &length, pData, sizeof( length ) );
+
+      const std::string_view View( reinterpret_cast<const c8 *>( pData ) +
+                                     sizeof( length ),
+                                   length );
+      pData += sizeof( length ) + length;
+      return View;
+    }
+    else
+    {
+      T value;
+      std::memcpy( &value, pData, sizeof( T ) );
+      pData += sizeof( T );
+      return value;
+    }
+  }
+
+  template <typename... Args>
+  std::string DecodeLogArgs( const std::string_view        format,
+                             [[maybe_unused]] const std::byte * pData )
+  {
+    // Braced initialization guarantees left-to-right evaluation.
+    std::tuple<LogStoredArg<Args>...> values { DecodeLogArg<Args>( pData )... };
+
+    return std::apply(
+      [ format ]( auto &... value )
+      { return std::vformat( format, std::make_format_args( value... ) ); },
+      values );
+  }
+
+  template <typename... Args> struct LogCodecFor
+  {
+    static constexpr std::array<LogArgType, sizeof...( Args )> s_ArgTypes = {
+      GetLogArgType<Args>()... };
+
+    static constexpr LogCodec s_Codec = { &DecodeLogArgs<Args...>, s_ArgTypes };
+  };
+} // namespace Engine::Utility
@@ -0,0 +1,55 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Utility
+{
+  // Monotonic tick source for log records.  Ticks are steady_clock counts so they
+  // are ordered across threads and can be subtracted to measure latency.
+  class LogClock
+  {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static u64 Now()
+    {
+      return static_cast<u64>( Clock::now().time_since_epoch().count() );
+    }
+
+    static std::chrono::nanoseconds ToDuration( u64 ticks );
+
+    // Maps a tick onto the wall clock using an anchor taken at startup.
+    static std::chrono::system_clock::time_point ToSystemTime( u64 tick );
+
+  private:
+    static const std::chrono::system_clock::time_point s_SystemAnchor;
+    static const Clock::time_point                     s_SteadyAnchor;
+  };
+
+  // Renders ticks as HH:MM:SS.mmm, recomputing the local-time prefix only when
+  // the second changes.  Not thread-safe; keep one per consumer.
+  class LogTimestampCache
+  {
+  public:
+    void Append( u64 tick, std::string & out );
+
+  private:
+    i64  m_CachedSecond = -1;
+    char m_Prefix[ 8 ]  = {};
+  };
+} // namespace Engine::Utility
@@ -0,0 +1,55 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Core/Types.hpp"
+#include "Engine/Utility/Logging/LogRecord.hpp"
+
+namespace Engine::Utility
+{
+  // Bounded multi-producer, single-consumer ring.  Each cell carries a sequence
+  // number so producers only contend on the enqueue cursor.
+  class LogQueue
+  {
+    DISALLOW_COPY( LogQueue );
+    DISALLOW_MOVE( LogQueue );
+
+  public:
+    explicit LogQueue( u32 capacity );
+    ~LogQueue() = default;
+
+    [[nodiscard]] bool TryPush( LogRecord && record );
+    [[nodiscard]] bool TryPop( LogRecord & record );
+
+    [[nodiscard]] u32 GetCapacity() const;
+
+  private:
+    static constexpr size s_CacheLineSize = 64;
+
+    struct alignas( s_CacheLineSize ) Cell
+    {
+      std::atomic<size> m_Sequence = 0;
+      LogRecord         m_Record   = {};
+    };
+
+    std::unique_ptr<Cell[]> m_pCells;
+    size                    m_Mask;
+
+    alignas( s_CacheLineSize ) std::atomic<size> m_EnqueuePosition;
+    alignas( s_CacheLineSize ) size m_DequeuePosition;
+  };
+} // namespace Engine::Utility
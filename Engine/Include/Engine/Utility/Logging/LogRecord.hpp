@@ -0,0 +1,40 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "Engine/Utility/Logger.hpp"
+#include "Engine/Utility/Logging/LogArgs.hpp"
+
+namespace Engine::Utility
+{
+  struct LogRecord
+  {
+    Logger::LogMetadata     m_Metadata = {};
+    const Logger::LogSite * m_pSite    = nullptr;
+    const LogCodec *        m_pCodec   = nullptr;
+    LogPayload              m_Payload;
+    std::string             m_Message  = {};
+    u64                     m_Tick     = 0;
+    u32                     m_ThreadId = 0;
+
+    // Returns the formatted message, decoding deferred arguments into scratch
+    // when needed.
+    [[nodiscard]] std::string_view ResolveMessage( std::string & scratch ) const;
+  };
+
+  // Small sequential id of the calling thread, assigned on its first log call.
+  [[nodiscard]] u32 GetLogThreadId();
+} // namespace Engine::Utility
@@ -0,0 +1,65 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Utility/Logger.hpp"
+#include "Engine/Utility/Logging/LogClock.hpp"
+
+namespace Engine::Utility
+{
+  struct LogRecord;
+
+  class LogSink
+  {
+    DISALLOW_COPY( LogSink );
+    DISALLOW_MOVE( LogSink );
+
+  public:
+    explicit LogSink( Logger::LogSeverity severity );
+    virtual ~LogSink() = default;
+
+    // Called with the sink lock held.  message is already resolved unless the
+    // sink opted out through IsMessageRequired().
+    virtual void Write( const LogRecord & record, std::string_view message ) = 0;
+
+    // Called after each batch of writes, which in sync mode is every record.  A
+    // buffering sink decides here whether the batch is worth pushing out.
+    virtual void EndBatch();
+
+    // Called by Logger::Flush, when the async writer goes idle and after a
+    // fatal record.
+    virtual void Flush();
+
+    [[nodiscard]] virtual bool IsMessageRequired() const;
+
+    void                              SetSeverity( Logger::LogSeverity severity );
+    [[nodiscard]] Logger::LogSeverity GetSeverity() const;
+    [[nodiscard]] bool ShouldLog( Logger::LogSeverity severity ) const;
+
+  protected:
+    // [HH:MM:SS.mmm] [LEVEL] file:line(function) message
+    void FormatLine( const LogRecord & record, std::string_view message,
+                     std::string & out );
+
+    static const char * GetSeverityName( Logger::LogSeverity severity );
+
+  private:
+    std::atomic<Logger::LogSeverity> m_Severity;
+    LogTimestampCache                m_TimestampCache;
+  };
+} // namespace Engine::Utility
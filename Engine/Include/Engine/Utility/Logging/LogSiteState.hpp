@@ -0,0 +1,108 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include "Engine/Core/Types.hpp"
+#include "Engine/Utility/Logging/LogClock.hpp"
+
+namespace Engine::Utility
+{
+  // Static per-call-site state behind LOG_*_ONCE, LOG_*_EVERY_N and
+  // LOG_*_RATE_LIMITED.  A suppressed call costs one relaxed atomic operation
+  // (plus a clock read for rate limiting).
+  class LogSiteState
+  {
+  public:
+    constexpr LogSiteState() = default;
+
+    [[nodiscard]] bool ShouldLogOnce()
+    {
+      return !m_Count.load( std::memory_order_relaxed ) &&
+             m_Count.exchange( 1, std::memory_order_relaxed ) == 0;
+    }
+
+    [[nodiscard]] bool ShouldLogEveryN( const u64 n )
+    {
+      return n <= 1 || m_Count.fetch_add( 1, std::memory_order_relaxed ) % n == 0;
+    }
+
+    // Token bucket implemented as GCRA: a single "theoretical arrival time"
+    // replaces the token count and refill timestamp.
+    [[nodiscard]] bool ShouldLogRateLimited( const u32 perSecond )
+    {
+      using namespace std::chrono;
+
+      const auto Interval = static_cast<u64>(
+        duration_cast<LogClock::Clock::duration>( seconds( 1 ) ).count() /
+        std::max( perSecond, 1u ) );
+      const auto Burst = Interval * ( std::max( perSecond, 1u ) - 1 );
+      const auto Now   = LogClock::Now();
+
+      // A lost exchange means another thread took a token first; retry
+      // against the arrival time it left rather than count a drop.
+      auto arrival = m_Count.load( std::memory_order_relaxed );
+      do
+      {
+        if ( Now + Burst < arrival )
+        {
+          m_SuppressedCount.fetch_add( 1, std::memory_order_relaxed );
+          return false;
+        }
+      } while ( !m_Count.compare_exchange_weak(
+        arrival, std::max( arrival, Now ) + Interval, std::memory_order_relaxed ) );
+
+      return true;
+    }
+
+    // True once the rate limit would admit a message again, i.e. the burst
+    // that caused any suppression is over.
+    [[nodiscard]] bool IsRateWindowOver( const u64 now ) const
+    {
+      return m_Count.load( std::memory_order_relaxed ) <= now;
+    }
+
+    // Claims the right to queue this site for a suppression summary; only the
+    // first suppression after each summary succeeds.
+    [[nodiscard]] bool TryQueueSummary()
+    {
+      return m_SuppressedCount.load( std::memory_order_relaxed ) != 0 &&
+             !m_IsSummaryQueued.load( std::memory_order_relaxed ) &&
+             !m_IsSummaryQueued.exchange( true, std::memory_order_relaxed );
+    }
+
+    void ReleaseSummary()
+    {
+      m_IsSummaryQueued.store( false, std::memory_order_relaxed );
+    }
+
+    [[nodiscard]] u64 TakeSuppressedCount()
+    {
+      if ( m_SuppressedCount.load( std::memory_order_relaxed ) == 0 )
+      {
+        return 0;
+      }
+
+      return m_SuppressedCount.exchange( 0, std::memory_order_relaxed );
+    }
+
+  private:
+    // Invocation count for ONCE/EVERY_N, theoretical arrival tick for RATE_LIMITED.
+    std::atomic<u64>  m_Count           = 0;
+    std::atomic<u64>  m_SuppressedCount = 0;
+    std::atomic<bool> m_IsSummaryQueued = false;
+  };
+} // namespace Engine::Utility
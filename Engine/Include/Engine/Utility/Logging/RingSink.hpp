@@ -0,0 +1,44 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Engine/Utility/Logging/LogSink.hpp"
+
+namespace Engine::Utility
+{
+  // Keeps the last N formatted lines in memory, e.g. for an in-game console.
+  class RingSink final : public LogSink
+  {
+  public:
+    explicit RingSink( u32                 capacity,
+                       Logger::LogSeverity severity = Logger::LogSeverity::m_Trace );
+    ~RingSink() override = default;
+
+    void Write( const LogRecord & record, std::string_view message ) override;
+
+    // Oldest line first.
+    [[nodiscard]] std::vector<std::string> GetLines() const;
+
+    void Clear();
+
+  private:
+    mutable std::mutex       m_Mutex;
+    std::vector<std::string> m_Lines;
+    u32                      m_Next;
+    u32                      m_Count;
+  };
+} // namespace Engine::Utility
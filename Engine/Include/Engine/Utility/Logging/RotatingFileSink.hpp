@@ -0,0 +1,64 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+#include "Engine/Utility/Logging/LogSink.hpp"
+
+namespace Engine::Utility
+{
+  // Writes through a preallocated, memory-mapped segment.  When a segment is full
+  // it is trimmed to its used size and rotated to <stem>.1<ext>, <stem>.2<ext>, ...
+  class RotatingFileSink final : public LogSink
+  {
+  public:
+    struct Config
+    {
+      std::filesystem::path m_Path        = "Triumph.log";
+      u64                   m_SegmentSize = 64ull * 1024 * 1024;
+      u32                   m_MaxFiles    = 5;
+    };
+
+    explicit RotatingFileSink(
+      const Config &      config,
+      Logger::LogSeverity severity = Logger::LogSeverity::m_Trace );
+    ~RotatingFileSink() override;
+
+    void Write( const LogRecord & record, std::string_view message ) override;
+
+    [[nodiscard]] bool IsOpen() const;
+
+  private:
+    bool OpenSegment();
+    void CloseSegment();
+    void Rotate();
+    void Append( std::string_view text );
+
+    [[nodiscard]] std::filesystem::path GetRotatedPath( u32 index ) const;
+
+    Config      m_Config;
+    std::string m_Line;
+
+    std::byte * m_pView;
+    u64         m_Offset;
+
+#if defined( _WIN32 )
+    void * m_pFile;
+    void * m_pMapping;
+#else
+    int m_File;
+#endif
+  };
+} // namespace Engine::Utility
@@ -0,0 +1,65 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "Engine/Core/Types.hpp"
+#include "Engine/Utility/String.hpp"
+
+namespace Engine::Utility::String
+{
+  // Converts input that arrives in chunks.  A code point split across chunks is
+  // held back until the next Feed() completes it, so memory stays bounded by the
+  // chunk size however large the stream is.
+  template <typename In, typename Out> class StreamTranscoder
+  {
+  public:
+    // Appends every complete code point of the chunk.  On malformed input the
+    // valid prefix is still appended, m_Read is its length within this chunk
+    // and the transcoder must be Reset() before reuse.
+    TranscodeResult Feed( std::basic_string_view<In> chunk,
+                          std::basic_string<Out> &   out );
+
+    // Ends the stream.  A sequence still waiting for its remaining units is
+    // reported as m_InvalidInput.
+    TranscodeResult Finish();
+
+    void Reset();
+
+    [[nodiscard]] bool HasPending() const
+    {
+      return m_PendingLength != 0;
+    }
+
+  private:
+    std::array<In, 4> m_Pending       = {};
+    u8                m_PendingLength = 0;
+  };
+
+  extern template class StreamTranscoder<c8, c16>;
+  extern template class StreamTranscoder<c8, c32>;
+  extern template class StreamTranscoder<c16, c8>;
+  extern template class StreamTranscoder<c16, c32>;
+  extern template class StreamTranscoder<c32, c8>;
+  extern template class StreamTranscoder<c32, c16>;
+
+  using Utf8ToUtf16Stream  = StreamTranscoder<c8, c16>;
+  using Utf8ToUtf32Stream  = StreamTranscoder<c8, c32>;
+  using Utf16ToUtf8Stream  = StreamTranscoder<c16, c8>;
+  using Utf16ToUtf32Stream = StreamTranscoder<c16, c32>;
+  using Utf32ToUtf8Stream  = StreamTranscoder<c32, c8>;
+  using Utf32ToUtf16Stream = StreamTranscoder<c32, c16>;
+} // namespace Engine::Utility::String
@@ -15,6 +15,7 @@
 #include <string_view>
 #include <string>
 #include <format>
+#include <span>
 
 #include "Engine/Core/Types.hpp"
 
@@ -41,6 +42,46 @@ namespace Engine::Utility::String
   bool IsUtf16( std::u16string_view utf16Str );
   bool IsUtf32( std::u32string_view utf32Str );
 
+  enum class TranscodeStatus : u8
+  {
+    m_Ok,
+    m_InvalidInput,
+    m_OutputTooSmall,
+  };
+
+  // Counts are in code units.  Conversion stops at the first malformed sequence,
+  // whose offset is then m_Read, or after the last code point the output fits.
+  struct TranscodeResult
+  {
+    TranscodeStatus m_Status  = TranscodeStatus::m_Ok;
+    size            m_Read    = 0;
+    size            m_Written = 0;
+
+    [[nodiscard]] bool IsOk() const
+    {
+      return m_Status == TranscodeStatus::m_Ok;
+    }
+  };
+
+  // Converts into a caller-owned buffer without allocating.
+  TranscodeResult ToUtf8( std::u16string_view utf16Str, std::span<c8> out );
+  TranscodeResult ToUtf8( std::u32string_view utf32Str, std::span<c8> out );
+  TranscodeResult ToUtf16( std::string_view str, std::span<c16> out );
+  TranscodeResult ToUtf16( std::u32string_view utf32Str, std::span<c16> out );
+  TranscodeResult ToUtf32( std::string_view str, std::span<c32> out );
+  TranscodeResult ToUtf32( std::u16string_view utf16Str, std::span<c32> out );
+
+  // Appends to a string, reusing its capacity.  Malformed input leaves the string
+  // unchanged.
+  TranscodeResult AppendUtf8( std::u16string_view utf16Str, std::string & str );
+  TranscodeResult AppendUtf8( std::u32string_view utf32Str, std::string & str );
+  TranscodeResult AppendUtf16( std::string_view str, std::u16string & utf16Str );
+  TranscodeResult AppendUtf16( std::u32string_view utf32Str,
+                               std::u16string &    utf16Str );
+  TranscodeResult AppendUtf32( std::string_view str, std::u32string & utf32Str );
+  TranscodeResult AppendUtf32( std::u16string_view utf16Str,
+                               std::u32string &    utf32Str );
+
   template <typename... Args>
   std::string Format( std::format_string<Args...> fmt, Args &&... args )
   {
@@ -87,6 +128,19 @@ namespace Engine::Utility::String
   }
 #endif
 
+  inline constexpr std::string_view s_Whitespace = " \t\n\r\f\v";
+
+  // Same results as the std::string_view members, but scanning a block of bytes
+  // at a time.
+  size FindFirstOf( std::string_view str, std::string_view set );
+  size FindFirstNotOf( std::string_view str, std::string_view set );
+  size FindLastNotOf( std::string_view str, std::string_view set );
+
+  // Views into the input; nothing is copied.
+  std::string_view TrimView( std::string_view str );
+  std::string_view TrimLeftView( std::string_view str );
+  std::string_view TrimRightView( std::string_view str );
+
   std::string Trim( std::string_view str );
   std::string TrimLeft( std::string_view str );
   std::string TrimRight( std::string_view str );
@@ -0,0 +1,106 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <compare>
+#include <format>
+#include <functional>
+#include <string_view>
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Utility
+{
+  // A string reduced to its 64-bit FNV-1a hash, so comparing and hashing ids is
+  // an integer operation.  Literals hash at compile time; Intern() additionally
+  // records the text so it can be recovered for logging.
+  class StringId
+  {
+  public:
+    constexpr StringId() = default;
+
+    constexpr explicit StringId( const std::string_view str )
+      : m_Hash( Hash( str ) )
+    {
+    }
+
+    // Lock-free once the text is known; the first call for a string takes the
+    // table's write lock.  Two different strings sharing a hash are logged.
+    static StringId Intern( std::string_view str );
+
+    // Empty if the text was never interned.
+    [[nodiscard]] std::string_view GetString() const;
+
+    [[nodiscard]] constexpr u64 GetHash() const
+    {
+      return m_Hash;
+    }
+
+    [[nodiscard]] constexpr bool IsValid() const
+    {
+      return m_Hash != 0;
+    }
+
+    constexpr bool operator==( const StringId & ) const  = default;
+    constexpr auto operator<=>( const StringId & ) const = default;
+
+    static constexpr u64 Hash( const std::string_view str )
+    {
+      u64 hash = s_OffsetBasis;
+      for ( const auto Char : str )
+      {
+        hash ^= static_cast<u8>( Char );
+        hash *= s_Prime;
+      }
+
+      return hash;
+    }
+
+  private:
+    static constexpr u64 s_OffsetBasis = 0xCBF29CE484222325;
+    static constexpr u64 s_Prime       = 0x100000001B3;
+
+    u64 m_Hash = 0;
+  };
+
+  namespace Literals
+  {
+    consteval StringId operator""_sid( const c8 * str, const size length )
+    {
+      return StringId { std::string_view { str, length } };
+    }
+  } // namespace Literals
+} // namespace Engine::Utility
+
+template <> struct std::hash<Engine::Utility::StringId>
+{
+  std::size_t operator()( const Engine::Utility::StringId id ) const noexcept
+  {
+    return static_cast<std::size_t>( id.GetHash() );
+  }
+};
+
+// Prints the interned text, or the hash when the text is unknown.
+template <> struct std::formatter<Engine::Utility::StringId>
+  : std::formatter<std::string_view>
+{
+  auto format( const Engine::Utility::StringId id, std::format_context & ctx ) const
+  {
+    if ( const auto Text = id.GetString(); !Text.empty() || !id.IsValid() )
+    {
+      return std::formatter<std::string_view>::format( Text, ctx );
+    }
+
+    return std::format_to( ctx.out(), "#{:016X}", id.GetHash() );
+  }
+};
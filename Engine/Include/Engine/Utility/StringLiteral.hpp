@@ -0,0 +1,154 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+#include "Engine/Core/Types.hpp"
+#include "Engine/Utility/Unicode/CodePoint.hpp"
+
+namespace Engine::Utility::String
+{
+  // A string literal usable as a template argument.
+  template <typename Unit, size N> struct StringLiteral
+  {
+    consteval StringLiteral( const Unit ( &str )[ N ] )
+    {
+      std::copy_n( str, N, m_Data );
+    }
+
+    [[nodiscard]] constexpr std::basic_string_view<Unit> View() const
+    {
+      return { m_Data, N - 1 };
+    }
+
+    Unit m_Data[ N ] = {};
+  };
+
+  // Deliberately not constexpr: reaching it while converting a literal fails the
+  // build.
+  void MalformedUtfLiteral();
+
+  template <typename In>
+  consteval size DecodeLiteral( const std::basic_string_view<In> str,
+                                const size                       offset,
+                                u32 &                            codePoint )
+  {
+    const auto Remaining = str.length() - offset;
+
+    size read = 0;
+    if constexpr ( sizeof( In ) == 1 )
+    {
+      read = Unicode::DecodeUtf8( str.data() + offset, Remaining, codePoint );
+    }
+    else if constexpr ( sizeof( In ) == 2 )
+    {
+      read = Unicode::DecodeUtf16( str.data() + offset, Remaining, codePoint );
+    }
+    else
+    {
+      codePoint = str[ offset ];
+      read      = codePoint <= 0x10FFFF &&
+             ( codePoint < 0xD800 || codePoint > 0xDFFF );
+    }
+
+    if ( read == 0 )
+    {
+      MalformedUtfLiteral();
+    }
+
+    return read;
+  }
+
+  // wchar_t is encoded by its width: UTF-16 on Windows, UTF-32 elsewhere.
+  template <typename Out>
+  consteval size EncodeLiteral( const u32 codePoint, Out * pOut )
+  {
+    if constexpr ( sizeof( Out ) == 1 )
+    {
+      return Unicode::EncodeUtf8( codePoint, pOut );
+    }
+    else if constexpr ( sizeof( Out ) == 2 )
+    {
+      c16        units[ 2 ] = {};
+      const auto Written    = Unicode::EncodeUtf16( codePoint, units );
+      std::copy_n( units, Written, pOut );
+      return Written;
+    }
+    else
+    {
+      pOut[ 0 ] = static_cast<Out>( codePoint );
+      return 1;
+    }
+  }
+
+  template <typename Out, typename In>
+  consteval size LiteralLength( const std::basic_string_view<In> str )
+  {
+    size length = 0;
+    for ( size i = 0; i < str.length(); )
+    {
+      u32 codePoint   = 0;
+      Out units[ 4 ]  = {};
+      i              += DecodeLiteral( str, i, codePoint );
+      length         += EncodeLiteral( codePoint, units );
+    }
+
+    return length;
+  }
+
+  // Converts a literal at compile time into a null-terminated array, so the
+  // result can be passed straight to C APIs.  Malformed literals do not compile.
+  template <typename Out, StringLiteral Str> consteval auto TranscodeLiteral()
+  {
+    constexpr auto Input  = Str.View();
+    constexpr auto Length = LiteralLength<Out>( Input );
+
+    std::array<Out, Length + 1> result = {};
+
+    size written = 0;
+    for ( size i = 0; i < Input.length(); )
+    {
+      u32 codePoint  = 0;
+      i             += DecodeLiteral( Input, i, codePoint );
+      written       += EncodeLiteral( codePoint, result.data() + written );
+    }
+
+    return result;
+  }
+
+  namespace Literals
+  {
+    template <StringLiteral Str> consteval auto operator""_utf8()
+    {
+      return TranscodeLiteral<c8, Str>();
+    }
+
+    template <StringLiteral Str> consteval auto operator""_utf16()
+    {
+      return TranscodeLiteral<c16, Str>();
+    }
+
+    template <StringLiteral Str> consteval auto operator""_utf32()
+    {
+      return TranscodeLiteral<c32, Str>();
+    }
+
+    template <StringLiteral Str> consteval auto operator""_wide()
+    {
+      return TranscodeLiteral<wchar_t, Str>();
+    }
+  } // namespace Literals
+} // namespace Engine::Utility::String
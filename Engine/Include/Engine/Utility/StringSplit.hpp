@@ -0,0 +1,225 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include "Engine/Core/Types.hpp"
+#include "Engine/Utility/String.hpp"
+
+namespace Engine::Utility::String
+{
+  // Lazily yields the fields between delimiters, including empty ones, as views
+  // into the input.  "a,,b" gives "a", "" and "b"; an empty input gives one empty
+  // field.
+  class SplitRange
+  {
+  public:
+    class Iterator
+    {
+    public:
+      using value_type      = std::string_view;
+      using difference_type = std::ptrdiff_t;
+
+      Iterator() = default;
+
+      Iterator( const std::string_view str, const c8 delimiter )
+        : m_Rest( str )
+        , m_Delimiter( delimiter )
+      {
+        Advance();
+      }
+
+      std::string_view operator*() const
+      {
+        return m_Current;
+      }
+
+      Iterator & operator++()
+      {
+        Advance();
+        return *this;
+      }
+
+      Iterator operator++( int )
+      {
+        auto previous = *this;
+        Advance();
+        return previous;
+      }
+
+      bool operator==( const Iterator & other ) const
+      {
+        return m_IsDone == other.m_IsDone &&
+               m_Current.data() == other.m_Current.data();
+      }
+
+      bool operator==( std::default_sentinel_t ) const
+      {
+        return m_IsDone;
+      }
+
+    private:
+      void Advance()
+      {
+        if ( m_IsLast )
+        {
+          m_IsDone = true;
+          return;
+        }
+
+        const auto End = FindFirstOf( m_Rest, { &m_Delimiter, 1 } );
+        if ( End == std::string_view::npos )
+        {
+          m_Current = m_Rest;
+          m_IsLast  = true;
+          return;
+        }
+
+        m_Current = m_Rest.substr( 0, End );
+        m_Rest.remove_prefix( End + 1 );
+      }
+
+      std::string_view m_Current   = {};
+      std::string_view m_Rest      = {};
+      c8               m_Delimiter = 0;
+      bool             m_IsLast    = false;
+      bool             m_IsDone    = false;
+    };
+
+    SplitRange( const std::string_view str, const c8 delimiter )
+      : m_Str( str )
+      , m_Delimiter( delimiter )
+    {
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+      return { m_Str, m_Delimiter };
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const
+    {
+      return {};
+    }
+
+  private:
+    std::string_view m_Str;
+    c8               m_Delimiter;
+  };
+
+  // Lazily yields the runs between any of the delimiters as views into the input,
+  // skipping empty ones.
+  class TokenRange
+  {
+  public:
+    class Iterator
+    {
+    public:
+      using value_type      = std::string_view;
+      using difference_type = std::ptrdiff_t;
+
+      Iterator() = default;
+
+      Iterator( const std::string_view str, const std::string_view delimiters )
+        : m_Rest( str )
+        , m_Delimiters( delimiters )
+      {
+        Advance();
+      }
+
+      std::string_view operator*() const
+      {
+        return m_Current;
+      }
+
+      Iterator & operator++()
+      {
+        Advance();
+        return *this;
+      }
+
+      Iterator operator++( int )
+      {
+        auto previous = *this;
+        Advance();
+        return previous;
+      }
+
+      bool operator==( const Iterator & other ) const
+      {
+        return m_IsDone == other.m_IsDone &&
+               m_Current.data() == other.m_Current.data();
+      }
+
+      bool operator==( std::default_sentinel_t ) const
+      {
+        return m_IsDone;
+      }
+
+    private:
+      void Advance()
+      {
+        const auto Start = FindFirstNotOf( m_Rest, m_Delimiters );
+        if ( Start == std::string_view::npos )
+        {
+          m_Current = {};
+          m_IsDone  = true;
+          return;
+        }
+
+        m_Rest.remove_prefix( Start );
+        m_Current = m_Rest.substr( 0, FindFirstOf( m_Rest, m_Delimiters ) );
+        m_Rest.remove_prefix( m_Current.length() );
+      }
+
+      std::string_view m_Current    = {};
+      std::string_view m_Rest       = {};
+      std::string_view m_Delimiters = {};
+      bool             m_IsDone     = false;
+    };
+
+    TokenRange( const std::string_view str, const std::string_view delimiters )
+      : m_Str( str )
+      , m_Delimiters( delimiters )
+    {
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+      return { m_Str, m_Delimiters };
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const
+    {
+      return {};
+    }
+
+  private:
+    std::string_view m_Str;
+    std::string_view m_Delimiters;
+  };
+
+  inline SplitRange Split( const std::string_view str, const c8 delimiter )
+  {
+    return { str, delimiter };
+  }
+
+  inline TokenRange Tokenize( const std::string_view str,
+                              const std::string_view delimiters = s_Whitespace )
+  {
+    return { str, delimiters };
+  }
+} // namespace Engine::Utility::String
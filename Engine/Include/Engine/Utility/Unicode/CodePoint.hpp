@@ -0,0 +1,171 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Utility::Unicode
+{
+  // Decodes one sequence of input already known to be valid UTF-8 and returns
+  // the number of bytes it used.
+  constexpr size DecodeValidUtf8( const u8 * pData, u32 & codePoint )
+  {
+    const auto Byte1 = pData[ 0 ];
+    if ( Byte1 < 0x80 )
+    {
+      codePoint = Byte1;
+      return 1;
+    }
+
+    if ( Byte1 < 0xE0 )
+    {
+      codePoint = ( Byte1 & 0x1Fu ) << 6 | ( pData[ 1 ] & 0x3Fu );
+      return 2;
+    }
+
+    if ( Byte1 < 0xF0 )
+    {
+      codePoint = ( Byte1 & 0x0Fu ) << 12 | ( pData[ 1 ] & 0x3Fu ) << 6 |
+                  ( pData[ 2 ] & 0x3Fu );
+      return 3;
+    }
+
+    codePoint = ( Byte1 & 0x07u ) << 18 | ( pData[ 1 ] & 0x3Fu ) << 12 |
+                ( pData[ 2 ] & 0x3Fu ) << 6 | ( pData[ 3 ] & 0x3Fu );
+    return 4;
+  }
+
+  // Decodes one code point of input already known to be valid UTF-16 and
+  // returns the number of units it used.
+  constexpr size DecodeValidUtf16( const c16 * pData, u32 & codePoint )
+  {
+    const u32 Unit1 = pData[ 0 ];
+    if ( Unit1 < 0xD800 || Unit1 > 0xDBFF )
+    {
+      codePoint = Unit1;
+      return 1;
+    }
+
+    codePoint = 0x10000 + ( ( Unit1 & 0x3FF ) << 10 ) + ( pData[ 1 ] & 0x3FFu );
+    return 2;
+  }
+
+  // Decodes one sequence of unvalidated UTF-8 and returns the number of bytes it
+  // used, or 0 for an overlong form, surrogate, value past U+10FFFF or truncated
+  // sequence.
+  constexpr size DecodeUtf8( const c8 * pData, const size length, u32 & codePoint )
+  {
+    const u32 Byte1 = static_cast<u8>( pData[ 0 ] );
+    if ( Byte1 < 0x80 )
+    {
+      codePoint = Byte1;
+      return 1;
+    }
+
+    const size Length = Byte1 > 0xF4   ? 0
+                        : Byte1 >= 0xF0 ? 4
+                        : Byte1 >= 0xE0 ? 3
+                        : Byte1 >= 0xC2 ? 2
+                                        : 0;
+    if ( Length == 0 || Length > length )
+    {
+      return 0;
+    }
+
+    codePoint = Byte1 & ( 0x7Fu >> Length );
+    for ( size i = 1; i < Length; ++i )
+    {
+      const u32 Byte = static_cast<u8>( pData[ i ] );
+      if ( ( Byte & 0xC0 ) != 0x80 )
+      {
+        return 0;
+      }
+
+      codePoint = codePoint << 6 | ( Byte & 0x3F );
+    }
+
+    const u32 Minimum = Length == 2 ? 0x80 : Length == 3 ? 0x800 : 0x10000;
+    if ( codePoint < Minimum || codePoint > 0x10FFFF ||
+         ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) )
+    {
+      return 0;
+    }
+
+    return Length;
+  }
+
+  // Decodes one code point of unvalidated UTF-16 and returns the number of units
+  // it used, or 0 for an unpaired surrogate.
+  constexpr size DecodeUtf16( const c16 * pData, const size length, u32 & codePoint )
+  {
+    const u32 Unit1 = pData[ 0 ];
+    if ( Unit1 < 0xD800 || Unit1 > 0xDFFF )
+    {
+      codePoint = Unit1;
+      return 1;
+    }
+
+    if ( Unit1 > 0xDBFF || length < 2 || pData[ 1 ] < 0xDC00 || pData[ 1 ] > 0xDFFF )
+    {
+      return 0;
+    }
+
+    return DecodeValidUtf16( pData, codePoint );
+  }
+
+  // Writes one to four UTF-8 bytes and returns how many were written.
+  constexpr size EncodeUtf8( const u32 codePoint, c8 * pOut )
+  {
+    if ( codePoint <= 0x7F )
+    {
+      pOut[ 0 ] = static_cast<c8>( codePoint );
+      return 1;
+    }
+
+    if ( codePoint <= 0x7FF )
+    {
+      pOut[ 0 ] = static_cast<c8>( 0xC0 | codePoint >> 6 );
+      pOut[ 1 ] = static_cast<c8>( 0x80 | ( codePoint & 0x3F ) );
+      return 2;
+    }
+
+    if ( codePoint <= 0xFFFF )
+    {
+      pOut[ 0 ] = static_cast<c8>( 0xE0 | codePoint >> 12 );
+      pOut[ 1 ] = static_cast<c8>( 0x80 | ( codePoint >> 6 & 0x3F ) );
+      pOut[ 2 ] = static_cast<c8>( 0x80 | ( codePoint & 0x3F ) );
+      return 3;
+    }
+
+    pOut[ 0 ] = static_cast<c8>( 0xF0 | codePoint >> 18 );
+    pOut[ 1 ] = static_cast<c8>( 0x80 | ( codePoint >> 12 & 0x3F ) );
+    pOut[ 2 ] = static_cast<c8>( 0x80 | ( codePoint >> 6 & 0x3F ) );
+    pOut[ 3 ] = static_cast<c8>( 0x80 | ( codePoint & 0x3F ) );
+    return 4;
+  }
+
+  // Writes one or two UTF-16 units and returns how many were written.
+  constexpr size EncodeUtf16( const u32 codePoint, c16 * pOut )
+  {
+    if ( codePoint <= 0xFFFF )
+    {
+      pOut[ 0 ] = static_cast<c16>( codePoint );
+      return 1;
+    }
+
+    const auto Offset = codePoint - 0x10000;
+    pOut[ 0 ]         = static_cast<c16>( 0xD800 + ( Offset >> 10 ) );
+    pOut[ 1 ]         = static_cast<c16>( 0xDC00 + ( Offset & 0x3FF ) );
+    return 2;
+  }
+} // namespace Engine::Utility::Unicode
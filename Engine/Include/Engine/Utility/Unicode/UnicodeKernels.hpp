@@ -0,0 +1,137 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <string_view>
+
+#include "Engine/Core/Types.hpp"
+
+namespace Engine::Utility::Unicode
+{
+  enum class SimdLevel : u8
+  {
+    m_Scalar,
+    m_Sse4,
+    m_Avx2,
+    m_Neon,
+  };
+
+  // One implementation of every bulk text routine.  The scalar set is the
+  // reference the vector sets are checked against.
+  struct UnicodeKernels
+  {
+    SimdLevel m_Level = SimdLevel::m_Scalar;
+
+    bool ( *m_pIsUtf8 )( std::string_view str )     = nullptr;
+    bool ( *m_pIsUtf16 )( std::u16string_view str ) = nullptr;
+    bool ( *m_pIsUtf32 )( std::u32string_view str ) = nullptr;
+
+    // Converters trust their input: validate first, then size the output
+    // exactly with the matching length function.
+    size ( *m_pUtf16LengthFromUtf8 )( std::string_view str )            = nullptr;
+    size ( *m_pUtf32LengthFromUtf8 )( std::string_view str )            = nullptr;
+    size ( *m_pConvertUtf8ToUtf16 )( std::string_view str, c16 * pOut ) = nullptr;
+    size ( *m_pConvertUtf8ToUtf32 )( std::string_view str, c32 * pOut ) = nullptr;
+
+    size ( *m_pUtf8LengthFromUtf16 )( std::u16string_view str )           = nullptr;
+    size ( *m_pUtf8LengthFromUtf32 )( std::u32string_view str )           = nullptr;
+    size ( *m_pConvertUtf16ToUtf8 )( std::u16string_view str, c8 * pOut ) = nullptr;
+    size ( *m_pConvertUtf32ToUtf8 )( std::u32string_view str, c8 * pOut ) = nullptr;
+  };
+
+  // Best level the running CPU supports; detected once.
+  [[nodiscard]] SimdLevel GetSimdLevel();
+
+  // Falls back to the scalar set for levels this build or CPU cannot run.
+  [[nodiscard]] const UnicodeKernels & GetUnicodeKernels( SimdLevel level );
+  [[nodiscard]] const UnicodeKernels & GetUnicodeKernels();
+
+  namespace Scalar
+  {
+    // Offset of the first malformed sequence, or the input length.
+    size ValidUtf8Length( std::string_view str );
+    size ValidUtf16Length( std::u16string_view utf16Str );
+    size ValidUtf32Length( std::u32string_view utf32Str );
+
+    // Conversions between UTF-16 and UTF-32 have no vector kernels.
+    size Utf16LengthFromUtf32( std::u32string_view utf32Str );
+    size Utf32LengthFromUtf16( std::u16string_view utf16Str );
+    size ConvertUtf32ToUtf16( std::u32string_view utf32Str, c16 * pOut );
+    size ConvertUtf16ToUtf32( std::u16string_view utf16Str, c32 * pOut );
+
+    bool IsUtf8( std::string_view str );
+    bool IsUtf16( std::u16string_view utf16Str );
+    bool IsUtf32( std::u32string_view utf32Str );
+
+    size Utf16LengthFromUtf8( std::string_view str );
+    size Utf32LengthFromUtf8( std::string_view str );
+    size ConvertUtf8ToUtf16( std::string_view str, c16 * pOut );
+    size ConvertUtf8ToUtf32( std::string_view str, c32 * pOut );
+
+    size Utf8LengthFromUtf16( std::u16string_view utf16Str );
+    size Utf8LengthFromUtf32( std::u32string_view utf32Str );
+    size ConvertUtf16ToUtf8( std::u16string_view utf16Str, c8 * pOut );
+    size ConvertUtf32ToUtf8( std::u32string_view utf32Str, c8 * pOut );
+  } // namespace Scalar
+
+  namespace Sse4
+  {
+    bool IsUtf8( std::string_view str );
+    bool IsUtf16( std::u16string_view utf16Str );
+    bool IsUtf32( std::u32string_view utf32Str );
+
+    size Utf16LengthFromUtf8( std::string_view str );
+    size Utf32LengthFromUtf8( std::string_view str );
+    size ConvertUtf8ToUtf16( std::string_view str, c16 * pOut );
+    size ConvertUtf8ToUtf32( std::string_view str, c32 * pOut );
+
+    size Utf8LengthFromUtf16( std::u16string_view utf16Str );
+    size Utf8LengthFromUtf32( std::u32string_view utf32Str );
+    size ConvertUtf16ToUtf8( std::u16string_view utf16Str, c8 * pOut );
+    size ConvertUtf32ToUtf8( std::u32string_view utf32Str, c8 * pOut );
+  } // namespace Sse4
+
+  namespace Avx2
+  {
+    bool IsUtf8( std::string_view str );
+    bool IsUtf16( std::u16string_view utf16Str );
+    bool IsUtf32( std::u32string_view utf32Str );
+
+    size Utf16LengthFromUtf8( std::string_view str );
+    size Utf32LengthFromUtf8( std::string_view str );
+    size ConvertUtf8ToUtf16( std::string_view str, c16 * pOut );
+    size ConvertUtf8ToUtf32( std::string_view str, c32 * pOut );
+
+    size Utf8LengthFromUtf16( std::u16string_view utf16Str );
+    size Utf8LengthFromUtf32( std::u32string_view utf32Str );
+    size ConvertUtf16ToUtf8( std::u16string_view utf16Str, c8 * pOut );
+    size ConvertUtf32ToUtf8( std::u32string_view utf32Str, c8 * pOut );
+  } // namespace Avx2
+
+  namespace Neon
+  {
+    bool IsUtf8( std::string_view str );
+    bool IsUtf16( std::u16string_view utf16Str );
+    bool IsUtf32( std::u32string_view utf32Str );
+
+    size Utf16LengthFromUtf8( std::string_view str );
+    size Utf32LengthFromUtf8( std::string_view str );
+    size ConvertUtf8ToUtf16( std::string_view str, c16 * pOut );
+    size ConvertUtf8ToUtf32( std::string_view str, c32 * pOut );
+
+    size Utf8LengthFromUtf16( std::u16string_view utf16Str );
+    size Utf8LengthFromUtf32( std::u32string_view utf32Str );
+    size ConvertUtf16ToUtf8( std::u16string_view utf16Str, c8 * pOut );
+    size ConvertUtf32ToUtf8( std::u32string_view utf32Str, c8 * pOut );
+  } // namespace Neon
+} // namespace Engine::Utility::Unicode
@@ -0,0 +1,125 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+
+#include "Engine/Core/Types.hpp"
+
+// Tables shared by the vector UTF-8 kernels.  Validation uses the nibble
+// lookups of Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction
+// Per Byte": each byte pair (previous byte, current byte) is classified by
+// three table lookups, and any bit left set after AND-ing them is an error.
+namespace Engine::Utility::Unicode::Utf8Lookup
+{
+  inline constexpr u8 s_TooShort     = 1 << 0;
+  inline constexpr u8 s_TooLong      = 1 << 1;
+  inline constexpr u8 s_Overlong3    = 1 << 2;
+  inline constexpr u8 s_TooLarge     = 1 << 3;
+  inline constexpr u8 s_Surrogate    = 1 << 4;
+  inline constexpr u8 s_Overlong2    = 1 << 5;
+  inline constexpr u8 s_TooLarge1000 = 1 << 6;
+  inline constexpr u8 s_Overlong4    = 1 << 6;
+  inline constexpr u8 s_TwoConts     = 1 << 7;
+  inline constexpr u8 s_Carry        = s_TooShort | s_TooLong | s_TwoConts;
+
+  // Indexed by the high nibble of the previous byte.
+  inline constexpr std::array<u8, 16> s_Byte1High = {
+    // 0xxx: ASCII
+    s_TooLong, s_TooLong, s_TooLong, s_TooLong, s_TooLong, s_TooLong, s_TooLong,
+    s_TooLong,
+    // 10xx: continuation
+    s_TwoConts, s_TwoConts, s_TwoConts, s_TwoConts,
+    // 1100: two-byte lead, overlong if C0/C1
+    s_TooShort | s_Overlong2,
+    // 1101: two-byte lead
+    s_TooShort,
+    // 1110: three-byte lead
+    s_TooShort | s_Overlong3 | s_Surrogate,
+    // 1111: four-byte lead
+    s_TooShort | s_TooLarge | s_TooLarge1000 | s_Overlong4 };
+
+  // Indexed by the low nibble of the previous byte.
+  inline constexpr std::array<u8, 16> s_Byte1Low = {
+    s_Carry | s_Overlong3 | s_Overlong2 | s_Overlong4,
+    s_Carry | s_Overlong2,
+    s_Carry,
+    s_Carry,
+    s_Carry | s_TooLarge,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000 | s_Surrogate,
+    s_Carry | s_TooLarge | s_TooLarge1000,
+    s_Carry | s_TooLarge | s_TooLarge1000 };
+
+  // Indexed by the high nibble of the current byte.
+  inline constexpr std::array<u8, 16> s_Byte2High = {
+    // 0xxx: ASCII
+    s_TooShort, s_TooShort, s_TooShort, s_TooShort, s_TooShort, s_TooShort,
+    s_TooShort, s_TooShort,
+    // 1000
+    s_TooLong | s_Overlong2 | s_TwoConts | s_Overlong3 | s_TooLarge1000 |
+      s_Overlong4,
+    // 1001
+    s_TooLong | s_Overlong2 | s_TwoConts | s_Overlong3 | s_TooLarge,
+    // 101x
+    s_TooLong | s_Overlong2 | s_TwoConts | s_Surrogate | s_TooLarge,
+    s_TooLong | s_Overlong2 | s_TwoConts | s_Surrogate | s_TooLarge,
+    // 11xx: lead byte
+    s_TooShort, s_TooShort, s_TooShort, s_TooShort };
+
+  // Subtracting these (saturating) from the last bytes of a block leaves a
+  // non-zero byte where a sequence is still waiting for continuation bytes.
+  // 32 bytes wide; 16-byte kernels use the upper half.
+  inline constexpr std::array<u8, 32> s_IncompleteMax = []
+  {
+    std::array<u8, 32> max {};
+    max.fill( 0xFF );
+    max[ 29 ] = 0xF0 - 1;
+    max[ 30 ] = 0xE0 - 1;
+    max[ 31 ] = 0xC0 - 1;
+    return max;
+  }();
+
+  // Byte shuffles that compact eight UTF-16 units, each pre-expanded to a
+  // little-endian pair of UTF-8 bytes, into their one- or two-byte encodings.
+  // Indexed by the mask of units that need two bytes; unused lanes select
+  // zero.
+  inline constexpr std::array<std::array<u8, 16>, 256> s_PackTwoByte = []
+  {
+    std::array<std::array<u8, 16>, 256> table {};
+    for ( u32 mask = 0; mask < 256; ++mask )
+    {
+      auto & entry = table[ mask ];
+      entry.fill( 0x80 );
+
+      u32 out = 0;
+      for ( u32 unit = 0; unit < 8; ++unit )
+      {
+        entry[ out++ ] = static_cast<u8>( unit * 2 );
+        if ( ( mask >> unit & 1 ) != 0 )
+        {
+          entry[ out++ ] = static_cast<u8>( unit * 2 + 1 );
+        }
+      }
+    }
+
+    return table;
+  }();
+} // namespace Engine::Utility::Unicode::Utf8Lookup
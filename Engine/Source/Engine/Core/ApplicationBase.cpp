@@ -15,14 +15,35 @@
 #include "Engine/Platform/WindowFactory.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Utility/Logger.hpp"
+#include "Engine/Utility/Logging/FlightRecorder.hpp"
 
 #include "Engine/Core/ApplicationBase.hpp"
 
 namespace Engine::Core
 {
+  static constexpr size s_FrameArenaCapacity = 1024 * 1024;
+  static constexpr u64  s_NoAllocationBudget  = ~u64( 0 );
+
+  // Early frames create swap chain resources and grow the frame arena, so the
+  // allocation budget only applies after them.
+  static constexpr u64 s_AllocationBudgetWarmupFrames = 60;
+
+#if defined( TRIUMPH_FRAME_ALLOCATION_BUDGET )
+  static constexpr u64 s_DefaultAllocationBudget = TRIUMPH_FRAME_ALLOCATION_BUDGET;
+#else
+  static constexpr u64 s_DefaultAllocationBudget = s_NoAllocationBudget;
+#endif
+
   ApplicationBase::ApplicationBase()
     : m_CloseListener()
     , m_ResizeListener()
+    , m_FrameAllocator( s_FrameArenaCapacity, TRIUMPH_FRAME_ARENA_BUFFERS )
+    , m_FrameStartAllocations()
+    , m_LastFrameAllocations()
+    , m_FrameAllocationBudget( s_DefaultAllocationBudget )
+    , m_FrameIndex( 0 )
+    , m_FrameStartTags()
+    , m_FrameStartTagCount( 0 )
     , m_IsRunning( false )
     , m_LastFrameTime( 0.0f )
   {
@@ -46,6 +67,9 @@ namespace Engine::Core
       const auto Delta = std::chrono::duration<f32>( time - last ).count();
       last             = time;
 
+      m_FrameAllocator.BeginFrame();
+      BeginFrameAllocations();
+
       m_pWindow->PollEvents();
       Update( Delta );
 
@@ -55,8 +79,16 @@ namespace Engine::Core
         Draw();
         m_pRenderer->EndDraw();
       }
+
+      EndFrameAllocations();
     }
 
+    LOG_INFO( "Frame arena: high-water {} bytes, capacity {} bytes across {} "
+              "buffer(s), {} overflow chunk(s)",
+              m_FrameAllocator.GetHighWater(), m_FrameAllocator.GetCapacity(),
+              m_FrameAllocator.GetBufferCount(),
+              m_FrameAllocator.GetOverflowCount() );
+
     Shutdown();
   }
 
@@ -75,8 +107,26 @@ namespace Engine::Core
     return *m_pRenderer;
   }
 
+  FrameAllocator & ApplicationBase::GetFrameAllocator()
+  {
+    return m_FrameAllocator;
+  }
+
+  AllocationStats ApplicationBase::GetLastFrameAllocations() const
+  {
+    return m_LastFrameAllocations;
+  }
+
+  void ApplicationBase::SetFrameAllocationBudget( const u64 maxAllocations )
+  {
+    m_FrameAllocationBudget = maxAllocations;
+  }
+
   void ApplicationBase::InternalInit()
   {
+    Utility::FlightRecorder::InstallCrashHandlers();
+    Utility::Logger::StartAsync( Utility::Logger::AsyncConfig {} );
+
     try
     {
       const Platform::WindowProps Props = {};
@@ -113,6 +163,8 @@ namespace Engine::Core
     {
       m_pWindow.reset();
     }
+
+    Utility::Logger::StopAsync();
   }
 
   void ApplicationBase::SetupEngineEventListeners()
@@ -126,4 +178,56 @@ namespace Engine::Core
       *m_pWindow, [ this ]( const WindowResizeEvent & event )
       { m_pRenderer->Resize( event.m_Width, event.m_Height ); } );
   }
+
+  void ApplicationBase::BeginFrameAllocations()
+  {
+    if constexpr ( AllocationTracker::IsEnabled() )
+    {
+      m_FrameStartAllocations = AllocationTracker::GetThreadStats();
+
+      if ( m_FrameAllocationBudget != s_NoAllocationBudget )
+      {
+        m_FrameStartTagCount = AllocationTracker::GetTagCount();
+        for ( u32 tag = 0; tag < m_FrameStartTagCount; ++tag )
+        {
+          m_FrameStartTags[ tag ] = AllocationTracker::GetTagStats( tag );
+        }
+      }
+    }
+  }
+
+  void ApplicationBase::EndFrameAllocations()
+  {
+    if constexpr ( AllocationTracker::IsEnabled() )
+    {
+      m_LastFrameAllocations =
+        AllocationTracker::GetThreadStats() - m_FrameStartAllocations;
+      ++m_FrameIndex;
+
+      if ( m_FrameIndex <= s_AllocationBudgetWarmupFrames ||
+           m_LastFrameAllocations.m_Allocations <= m_FrameAllocationBudget )
+      {
+        return;
+      }
+
+      // Tag counters include every thread, so they can add up to more than the
+      // frame total.  Tags registered during the frame have no snapshot and are
+      // left out.
+      for ( u32 tag = 0; tag < m_FrameStartTagCount; ++tag )
+      {
+        const auto Delta =
+          AllocationTracker::GetTagStats( tag ) - m_FrameStartTags[ tag ];
+        if ( Delta.m_Allocations != 0 )
+        {
+          LOG_ERROR( "  {}: {} allocation(s), {} bytes",
+                     AllocationTracker::GetTagName( tag ), Delta.m_Allocations,
+                     Delta.m_Bytes );
+        }
+      }
+
+      LOG_FATAL( "Frame {} made {} heap allocation(s) ({} bytes); the budget is {}",
+                 m_FrameIndex, m_LastFrameAllocations.m_Allocations,
+                 m_LastFrameAllocations.m_Bytes, m_FrameAllocationBudget );
+    }
+  }
 } // namespace Engine::Core
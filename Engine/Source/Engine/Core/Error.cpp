@@ -0,0 +1,31 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include "Engine/Core/Error.hpp"
+
+namespace Engine
+{
+  std::string Error::ToString() const
+  {
+    if ( m_pDescribe )
+    {
+      return std::format( "{}: {}", m_pReason, m_pDescribe( m_Code ) );
+    }
+
+    if ( m_Code != 0 )
+    {
+      return std::format( "{} (code {})", m_pReason, m_Code );
+    }
+
+    return m_pReason;
+  }
+} // namespace Engine
@@ -0,0 +1,315 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#if defined( _WIN32 )
+#include <malloc.h>
+#endif
+
+#include "Engine/Core/Memory/AllocationTracker.hpp"
+
+namespace Engine::Core
+{
+  struct TagSlot
+  {
+    std::atomic<const char *> m_pName       = nullptr;
+    std::atomic<u64>          m_Allocations = 0;
+    std::atomic<u64>          m_Bytes       = 0;
+  };
+
+  struct ThreadCounters
+  {
+    AllocationStats m_Stats;
+    u32             m_Tag;
+  };
+
+  static TagSlot          s_Tags[ AllocationTracker::s_MaxTags ];
+  static std::atomic<u32> s_TagCount = 1;
+  static std::mutex       s_TagMutex;
+
+  static constexpr auto s_pUntaggedName = "Untagged";
+
+  // Constant-initialized so operator new can touch it before anything else on a
+  // new thread has run.
+  static thread_local constinit ThreadCounters s_ThreadCounters = {};
+
+  AllocationStats AllocationTracker::GetThreadStats()
+  {
+    return s_ThreadCounters.m_Stats;
+  }
+
+  u32 AllocationTracker::RegisterTag( const char * pName )
+  {
+    const std::scoped_lock Lock( s_TagMutex );
+
+    const auto Count = s_TagCount.load( std::memory_order_relaxed );
+    for ( u32 tag = 1; tag < Count; ++tag )
+    {
+      if ( std::strcmp( s_Tags[ tag ].m_pName.load( std::memory_order_relaxed ),
+                        pName ) == 0 )
+      {
+        return tag;
+      }
+    }
+
+    if ( Count == s_MaxTags )
+    {
+      return s_UntaggedTag;
+    }
+
+    s_Tags[ Count ].m_pName.store( pName, std::memory_order_relaxed );
+    s_TagCount.store( Count + 1, std::memory_order_release );
+    return Count;
+  }
+
+  u32 AllocationTracker::GetTagCount()
+  {
+    return s_TagCount.load( std::memory_order_acquire );
+  }
+
+  const char * AllocationTracker::GetTagName( const u32 tag )
+  {
+    if ( tag == s_UntaggedTag || tag >= GetTagCount() )
+    {
+      return s_pUntaggedName;
+    }
+
+    return s_Tags[ tag ].m_pName.load( std::memory_order_relaxed );
+  }
+
+  AllocationStats AllocationTracker::GetTagStats( const u32 tag )
+  {
+    if ( tag >= s_MaxTags )
+    {
+      return {};
+    }
+
+    const auto &    Slot  = s_Tags[ tag ];
+    AllocationStats stats = {};
+    stats.m_Allocations   = Slot.m_Allocations.load( std::memory_order_relaxed );
+    stats.m_Bytes         = Slot.m_Bytes.load( std::memory_order_relaxed );
+    return stats;
+  }
+
+  MemoryScope::MemoryScope( const u32 tag )
+    : m_Previous( s_ThreadCounters.m_Tag )
+  {
+    s_ThreadCounters.m_Tag = tag;
+  }
+
+  MemoryScope::~MemoryScope()
+  {
+    s_ThreadCounters.m_Tag = m_Previous;
+  }
+
+#if TRIUMPH_TRACK_ALLOCATIONS
+  static void RecordAllocation( const size bytes )
+  {
+    auto & counters = s_ThreadCounters;
+    ++counters.m_Stats.m_Allocations;
+    counters.m_Stats.m_Bytes += bytes;
+
+    auto & slot = s_Tags[ counters.m_Tag ];
+    slot.m_Allocations.fetch_add( 1, std::memory_order_relaxed );
+    slot.m_Bytes.fetch_add( bytes, std::memory_order_relaxed );
+  }
+
+  static void RecordFree( const void * pData )
+  {
+    if ( pData )
+    {
+      ++s_ThreadCounters.m_Stats.m_Frees;
+    }
+  }
+
+  static void * AllocateTracked( const size bytes )
+  {
+    void * pData = std::malloc( bytes ? bytes : 1 );
+    if ( pData )
+    {
+      RecordAllocation( bytes );
+    }
+
+    return pData;
+  }
+
+  static void * AllocateAlignedTracked( const size bytes,
+                                        const std::align_val_t align )
+  {
+    const auto Alignment = static_cast<size>( align );
+    const auto Bytes     = bytes ? bytes : 1;
+#if defined( _WIN32 )
+    void * pData = _aligned_malloc( Bytes, Alignment );
+#else
+    // aligned_alloc wants a multiple of the alignment.
+    const auto Rounded = ( Bytes + Alignment - 1 ) & ~( Alignment - 1 );
+    void *     pData   = std::aligned_alloc( Alignment, Rounded );
+#endif
+    if ( pData )
+    {
+      RecordAllocation( bytes );
+    }
+
+    return pData;
+  }
+
+  static void FreeTracked( void * pData )
+  {
+    RecordFree( pData );
+    std::free( pData );
+  }
+
+  static void FreeAlignedTracked( void * pData )
+  {
+    RecordFree( pData );
+#if defined( _WIN32 )
+    _aligned_free( pData );
+#else
+    std::free( pData );
+#endif
+  }
+
+  // The throwing forms retry through the new-handler as the standard requires.
+  template <typename Allocate> static void * AllocateOrThrow( Allocate allocate )
+  {
+    while ( true )
+    {
+      if ( void * pData = allocate() )
+      {
+        return pData;
+      }
+
+      const auto Handler = std::get_new_handler();
+      if ( !Handler )
+      {
+        throw std::bad_alloc();
+      }
+
+      Handler();
+    }
+  }
+#endif
+} // namespace Engine::Core
+
+#if TRIUMPH_TRACK_ALLOCATIONS
+void * operator new( const size bytes )
+{
+  return Engine::Core::AllocateOrThrow(
+    [ bytes ] { return Engine::Core::AllocateTracked( bytes ); } );
+}
+
+void * operator new[]( const size bytes )
+{
+  return operator new( bytes );
+}
+
+void * operator new( const size bytes, const std::nothrow_t & ) noexcept
+{
+  return Engine::Core::AllocateTracked( bytes );
+}
+
+void * operator new[]( const size bytes, const std::nothrow_t & ) noexcept
+{
+  return Engine::Core::AllocateTracked( bytes );
+}
+
+void * operator new( const size bytes, const std::align_val_t align )
+{
+  return Engine::Core::AllocateOrThrow(
+    [ bytes, align ]
+    { return Engine::Core::AllocateAlignedTracked( bytes, align ); } );
+}
+
+void * operator new[]( const size bytes, const std::align_val_t align )
+{
+  return operator new( bytes, align );
+}
+
+void * operator new( const size bytes, const std::align_val_t align,
+                     const std::nothrow_t & ) noexcept
+{
+  return Engine::Core::AllocateAlignedTracked( bytes, align );
+}
+
+void * operator new[]( const size bytes, const std::align_val_t align,
+                       const std::nothrow_t & ) noexcept
+{
+  return Engine::Core::AllocateAlignedTracked( bytes, align );
+}
+
+void operator delete( void * pData ) noexcept
+{
+  Engine::Core::FreeTracked( pData );
+}
+
+void operator delete[]( void * pData ) noexcept
+{
+  Engine::Core::FreeTracked( pData );
+}
+
+void operator delete( void * pData, size ) noexcept
+{
+  Engine::Core::FreeTracked( pData );
+}
+
+void operator delete[]( void * pData, size ) noexcept
+{
+  Engine::Core::FreeTracked( pData );
+}
+
+void operator delete( void * pData, const std::nothrow_t & ) noexcept
+{
+  Engine::Core::FreeTracked( pData );
+}
+
+void operator delete[]( void * pData, const std::nothrow_t & ) noexcept
+{
+  Engine::Core::FreeTracked( pData );
+}
+
+void operator delete( void * pData, std::align_val_t ) noexcept
+{
+  Engine::Core::FreeAlignedTracked( pData );
+}
+
+void operator delete[]( void * pData, std::align_val_t ) noexcept
+{
+  Engine::Core::FreeAlignedTracked( pData );
+}
+
+void operator delete( void * pData, size, std::align_val_t ) noexcept
+{
+  Engine::Core::FreeAlignedTracked( pData );
+}
+
+void operator delete[]( void * pData, size, std::align_val_t ) noexcept
+{
+  Engine::Core::FreeAlignedTracked( pData );
+}
+
+void operator delete( void * pData, std::align_val_t,
+                      const std::nothrow_t & ) noexcept
+{
+  Engine::Core::FreeAlignedTracked( pData );
+}
+
+void operator delete[]( void * pData, std::align_val_t,
+                        const std::nothrow_t & ) noexcept
+{
+  Engine::Core::FreeAlignedTracked( pData );
+}
+#endif
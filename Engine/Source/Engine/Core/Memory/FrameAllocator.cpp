@@ -0,0 +1,96 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+
+#include "Engine/Core/Memory/FrameAllocator.hpp"
+
+namespace Engine::Core
+{
+  FrameAllocator::FrameAllocator( const size capacityPerFrame,
+                                  const u32  bufferCount )
+    : m_pArenas()
+    , m_BufferCount( std::clamp( bufferCount, 1u, s_MaxBuffers ) )
+    , m_Current( 0 )
+  {
+    for ( u32 i = 0; i < m_BufferCount; ++i )
+    {
+      m_pArenas[ i ] = std::make_unique<LinearArena>( capacityPerFrame );
+    }
+  }
+
+  void FrameAllocator::BeginFrame()
+  {
+    m_Current = ( m_Current + 1 ) % m_BufferCount;
+    m_pArenas[ m_Current ]->Reset();
+  }
+
+  LinearArena & FrameAllocator::GetCurrentArena() const
+  {
+    return *m_pArenas[ m_Current ];
+  }
+
+  u32 FrameAllocator::GetBufferCount() const
+  {
+    return m_BufferCount;
+  }
+
+  size FrameAllocator::GetHighWater() const
+  {
+    size highWater = 0;
+    for ( u32 i = 0; i < m_BufferCount; ++i )
+    {
+      highWater = std::max( highWater, m_pArenas[ i ]->GetHighWater() );
+    }
+
+    return highWater;
+  }
+
+  size FrameAllocator::GetCapacity() const
+  {
+    size capacity = 0;
+    for ( u32 i = 0; i < m_BufferCount; ++i )
+    {
+      capacity += m_pArenas[ i ]->GetCapacity();
+    }
+
+    return capacity;
+  }
+
+  u32 FrameAllocator::GetOverflowCount() const
+  {
+    u32 overflows = 0;
+    for ( u32 i = 0; i < m_BufferCount; ++i )
+    {
+      overflows += m_pArenas[ i ]->GetOverflowCount();
+    }
+
+    return overflows;
+  }
+
+  void * FrameAllocator::do_allocate( const size bytes, const size alignment )
+  {
+    return GetCurrentArena().allocate( bytes, alignment );
+  }
+
+  void FrameAllocator::do_deallocate( void * pData, const size bytes,
+                                      const size alignment )
+  {
+    GetCurrentArena().deallocate( pData, bytes, alignment );
+  }
+
+  bool FrameAllocator::do_is_equal(
+    const std::pmr::memory_resource & other ) const noexcept
+  {
+    return this == &other;
+  }
+} // namespace Engine::Core
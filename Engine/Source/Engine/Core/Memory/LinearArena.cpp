@@ -0,0 +1,136 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <bit>
+
+#include "Engine/Core/Memory/LinearArena.hpp"
+
+namespace Engine::Core
+{
+  static size AlignPadding( const std::byte * pAddress, const size alignment )
+  {
+    const auto Address = reinterpret_cast<std::uintptr_t>( pAddress );
+    return ( alignment - ( Address & ( alignment - 1 ) ) ) & ( alignment - 1 );
+  }
+
+  LinearArena::LinearArena( const size capacity )
+    : m_pBlock( std::make_unique_for_overwrite<std::byte[]>( capacity ) )
+    , m_Capacity( capacity )
+    , m_Offset( 0 )
+    , m_OverflowOffset( 0 )
+    , m_Used( 0 )
+    , m_HighWater( 0 )
+    , m_OverflowCount( 0 )
+  {
+  }
+
+  void LinearArena::Reset()
+  {
+    m_HighWater = std::max( m_HighWater, m_Used );
+
+    if ( !m_Overflow.empty() )
+    {
+      // Every chunk is freed at once, so grow the block to cover what this
+      // frame actually needed instead of paying for overflow again next time.
+      m_Capacity = std::bit_ceil( m_HighWater );
+      m_pBlock   = std::make_unique_for_overwrite<std::byte[]>( m_Capacity );
+      m_Overflow.clear();
+    }
+
+    m_Offset         = 0;
+    m_OverflowOffset = 0;
+    m_Used           = 0;
+  }
+
+  size LinearArena::GetCapacity() const
+  {
+    return m_Capacity;
+  }
+
+  size LinearArena::GetUsed() const
+  {
+    return m_Used;
+  }
+
+  size LinearArena::GetHighWater() const
+  {
+    return std::max( m_HighWater, m_Used );
+  }
+
+  u32 LinearArena::GetOverflowCount() const
+  {
+    return m_OverflowCount;
+  }
+
+  void * LinearArena::do_allocate( const size bytes, const size alignment )
+  {
+    std::byte * pTop    = m_pBlock.get() + m_Offset;
+    const auto  Padding = AlignPadding( pTop, alignment );
+
+    if ( m_Overflow.empty() && Padding + bytes <= m_Capacity - m_Offset )
+    {
+      m_Offset += Padding + bytes;
+      m_Used   += Padding + bytes;
+      return pTop + Padding;
+    }
+
+    return AllocateOverflow( bytes, alignment );
+  }
+
+  void LinearArena::do_deallocate( void * pData, const size bytes, size )
+  {
+    auto * pEnd = static_cast<std::byte *>( pData ) + bytes;
+    if ( m_Overflow.empty() && pEnd == m_pBlock.get() + m_Offset )
+    {
+      m_Offset -= bytes;
+      m_Used   -= bytes;
+    }
+  }
+
+  bool LinearArena::do_is_equal(
+    const std::pmr::memory_resource & other ) const noexcept
+  {
+    return this == &other;
+  }
+
+  void * LinearArena::AllocateOverflow( const size bytes, const size alignment )
+  {
+    if ( !m_Overflow.empty() )
+    {
+      Chunk &     chunk   = m_Overflow.back();
+      std::byte * pTop    = chunk.m_pData.get() + m_OverflowOffset;
+      const auto  Padding = AlignPadding( pTop, alignment );
+
+      if ( Padding + bytes <= chunk.m_Capacity - m_OverflowOffset )
+      {
+        m_OverflowOffset += Padding + bytes;
+        m_Used           += Padding + bytes;
+        return pTop + Padding;
+      }
+    }
+
+    // Worst-case padding is alignment - 1 since new[] only guarantees the
+    // default new alignment.
+    const auto Capacity = std::max( m_Capacity, bytes + alignment );
+    auto &     chunk    = m_Overflow.emplace_back(
+      Chunk { std::make_unique_for_overwrite<std::byte[]>( Capacity ), Capacity } );
+    ++m_OverflowCount;
+
+    std::byte * pTop    = chunk.m_pData.get();
+    const auto  Padding = AlignPadding( pTop, alignment );
+
+    m_OverflowOffset  = Padding + bytes;
+    m_Used           += Padding + bytes;
+    return pTop + Padding;
+  }
+} // namespace Engine::Core
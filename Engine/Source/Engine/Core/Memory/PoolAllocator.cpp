@@ -0,0 +1,315 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <new>
+
+#include "Engine/Core/Memory/PoolAllocator.hpp"
+
+namespace Engine::Core
+{
+  // Lives in the first bytes of every free block.  m_pNextBatch is only read
+  // through the head of a batch, and may be read by a thread that then loses
+  // the pop race, hence atomic.
+  struct FreeBlock
+  {
+    FreeBlock *              m_pNext;
+    std::atomic<FreeBlock *> m_pNextBatch;
+  };
+
+  static_assert( sizeof( FreeBlock ) <= PoolAllocator::s_MinBlockSize );
+
+  static constexpr size s_SlabSize = 64 * 1024;
+
+  // The shared list head packs a 48-bit pointer with a 16-bit pop counter so a
+  // block popped and pushed back between a load and its CAS is not mistaken
+  // for an unchanged head.  User-space addresses fit in 48 bits on every
+  // platform the engine targets.
+  static constexpr u32 s_TagShift    = 48;
+  static constexpr u64 s_PointerMask = ( u64( 1 ) << s_TagShift ) - 1;
+
+  static_assert( sizeof( void * ) == sizeof( u64 ) );
+
+  static FreeBlock * UnpackPointer( const u64 head )
+  {
+    return reinterpret_cast<FreeBlock *>( head & s_PointerMask );
+  }
+
+  static u64 PackHead( const FreeBlock * pBlock, const u64 previous )
+  {
+    const auto Tag = ( ( previous >> s_TagShift ) + 1 ) << s_TagShift;
+    return reinterpret_cast<std::uintptr_t>( pBlock ) | Tag;
+  }
+
+  struct alignas( 64 ) SizeClass
+  {
+    std::atomic<u64>  m_Head          = 0;
+    std::atomic<size> m_ReservedBytes = 0;
+    std::atomic<u64>  m_Allocations   = 0;
+    std::atomic<u64>  m_Frees         = 0;
+  };
+
+  // Trivially destructible so blocks freed during static destruction still
+  // have somewhere to go.
+  static SizeClass s_Classes[ PoolAllocator::s_ClassCount ];
+
+  static constexpr size GetBlockSize( const u32 sizeClass )
+  {
+    return PoolAllocator::s_MinBlockSize << sizeClass;
+  }
+
+  static u32 GetSizeClass( const size bytes )
+  {
+    if ( bytes <= PoolAllocator::s_MinBlockSize )
+    {
+      return 0;
+    }
+
+    return static_cast<u32>( std::bit_width( bytes - 1 ) ) -
+           static_cast<u32>( std::bit_width( PoolAllocator::s_MinBlockSize - 1 ) );
+  }
+
+  static void PushBatch( SizeClass & sizeClass, FreeBlock * pBatch )
+  {
+    auto head = sizeClass.m_Head.load( std::memory_order_relaxed );
+    do
+    {
+      pBatch->m_pNextBatch.store( UnpackPointer( head ), std::memory_order_relaxed );
+    } while ( !sizeClass.m_Head.compare_exchange_weak(
+      head, PackHead( pBatch, head ), std::memory_order_release,
+      std::memory_order_relaxed ) );
+  }
+
+  static FreeBlock * PopBatch( SizeClass & sizeClass )
+  {
+    auto head = sizeClass.m_Head.load( std::memory_order_acquire );
+    while ( auto * pBatch = UnpackPointer( head ) )
+    {
+      // Slabs are never freed, so pBatch stays readable even if another
+      // thread pops it first; the tag then makes the CAS fail.
+      const auto * pNext = pBatch->m_pNextBatch.load( std::memory_order_relaxed );
+      if ( sizeClass.m_Head.compare_exchange_weak( head, PackHead( pNext, head ),
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_acquire ) )
+      {
+        return pBatch;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Splits a new slab into batches, publishes all but the first and returns
+  // that one to the caller.
+  static FreeBlock * CarveSlab( const u32 sizeClassIndex )
+  {
+    auto &     sizeClass = s_Classes[ sizeClassIndex ];
+    const auto BlockSize = GetBlockSize( sizeClassIndex );
+    const auto Count     = s_SlabSize / BlockSize;
+
+    auto * pSlab = static_cast<std::byte *>( ::operator new( s_SlabSize ) );
+    sizeClass.m_ReservedBytes.fetch_add( s_SlabSize, std::memory_order_relaxed );
+
+    FreeBlock * pFirst = nullptr;
+    for ( size start = 0; start < Count; start += PoolAllocator::s_BatchSize )
+    {
+      const auto  End   = std::min( start + PoolAllocator::s_BatchSize, Count );
+      FreeBlock * pNext = nullptr;
+
+      for ( size i = End; i-- > start; )
+      {
+        pNext = ::new ( pSlab + i * BlockSize ) FreeBlock { pNext, nullptr };
+      }
+
+      if ( !pFirst )
+      {
+        pFirst = pNext;
+      }
+      else
+      {
+        PushBatch( sizeClass, pNext );
+      }
+    }
+
+    return pFirst;
+  }
+
+  class ThreadCache
+  {
+  public:
+    ThreadCache() = default;
+
+    ~ThreadCache()
+    {
+      Flush();
+    }
+
+    void * Allocate( const u32 sizeClass )
+    {
+      auto & bin = m_Bins[ sizeClass ];
+      if ( !bin.m_pHead )
+      {
+        Refill( sizeClass );
+      }
+
+      auto * pBlock = bin.m_pHead;
+      bin.m_pHead   = pBlock->m_pNext;
+      --bin.m_Count;
+      ++bin.m_Allocations;
+
+      return pBlock;
+    }
+
+    void Free( void * pData, const u32 sizeClass )
+    {
+      auto & bin  = m_Bins[ sizeClass ];
+      bin.m_pHead = ::new ( pData ) FreeBlock { bin.m_pHead, nullptr };
+      ++bin.m_Count;
+      ++bin.m_Frees;
+
+      // Keep one batch around so alternating alloc/free at the boundary
+      // does not bounce a batch through the shared list every time.
+      if ( bin.m_Count >= 2 * PoolAllocator::s_BatchSize )
+      {
+        auto * pLast = bin.m_pHead;
+        for ( u32 i = 1; i < PoolAllocator::s_BatchSize; ++i )
+        {
+          pLast = pLast->m_pNext;
+        }
+
+        auto * pBatch  = bin.m_pHead;
+        bin.m_pHead    = pLast->m_pNext;
+        pLast->m_pNext = nullptr;
+        bin.m_Count   -= PoolAllocator::s_BatchSize;
+
+        PushBatch( s_Classes[ sizeClass ], pBatch );
+        Publish( sizeClass );
+      }
+    }
+
+    void Flush()
+    {
+      for ( u32 sizeClass = 0; sizeClass < PoolAllocator::s_ClassCount;
+            ++sizeClass )
+      {
+        auto & bin = m_Bins[ sizeClass ];
+        if ( bin.m_pHead )
+        {
+          PushBatch( s_Classes[ sizeClass ], bin.m_pHead );
+          bin.m_pHead = nullptr;
+          bin.m_Count = 0;
+        }
+
+        Publish( sizeClass );
+      }
+    }
+
+  private:
+    struct Bin
+    {
+      FreeBlock * m_pHead       = nullptr;
+      u32         m_Count       = 0;
+      u64         m_Allocations = 0;
+      u64         m_Frees       = 0;
+    };
+
+    void Refill( const u32 sizeClass )
+    {
+      auto & bin    = m_Bins[ sizeClass ];
+      auto * pBatch = PopBatch( s_Classes[ sizeClass ] );
+      if ( !pBatch )
+      {
+        pBatch = CarveSlab( sizeClass );
+      }
+
+      bin.m_pHead = pBatch;
+      bin.m_Count = 0;
+      for ( auto * pBlock = pBatch; pBlock; pBlock = pBlock->m_pNext )
+      {
+        ++bin.m_Count;
+      }
+
+      Publish( sizeClass );
+    }
+
+    void Publish( const u32 sizeClass )
+    {
+      auto & bin    = m_Bins[ sizeClass ];
+      auto & shared = s_Classes[ sizeClass ];
+
+      shared.m_Allocations.fetch_add( bin.m_Allocations, std::memory_order_relaxed );
+      shared.m_Frees.fetch_add( bin.m_Frees, std::memory_order_relaxed );
+      bin.m_Allocations = 0;
+      bin.m_Frees       = 0;
+    }
+
+    std::array<Bin, PoolAllocator::s_ClassCount> m_Bins;
+  };
+
+  static ThreadCache & GetThreadCache()
+  {
+    thread_local ThreadCache s_Cache;
+
+    return s_Cache;
+  }
+
+  void * PoolAllocator::Allocate( const size bytes )
+  {
+    if ( bytes > s_MaxBlockSize )
+    {
+      return ::operator new( bytes );
+    }
+
+    return GetThreadCache().Allocate( GetSizeClass( bytes ) );
+  }
+
+  void PoolAllocator::Free( void * pBlock, const size bytes )
+  {
+    if ( !pBlock )
+    {
+      return;
+    }
+
+    if ( bytes > s_MaxBlockSize )
+    {
+      ::operator delete( pBlock );
+      return;
+    }
+
+    GetThreadCache().Free( pBlock, GetSizeClass( bytes ) );
+  }
+
+  void PoolAllocator::FlushThreadCache()
+  {
+    GetThreadCache().Flush();
+  }
+
+  std::array<PoolStats, PoolAllocator::s_ClassCount> PoolAllocator::GetStats()
+  {
+    std::array<PoolStats, s_ClassCount> stats = {};
+    for ( u32 sizeClass = 0; sizeClass < s_ClassCount; ++sizeClass )
+    {
+      const auto & Shared = s_Classes[ sizeClass ];
+
+      stats[ sizeClass ] = {
+        GetBlockSize( sizeClass ),
+        Shared.m_ReservedBytes.load( std::memory_order_relaxed ),
+        Shared.m_Allocations.load( std::memory_order_relaxed ),
+        Shared.m_Frees.load( std::memory_order_relaxed ),
+      };
+    }
+
+    return stats;
+  }
+} // namespace Engine::Core
@@ -0,0 +1,87 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <new>
+
+#include "Engine/Core/Memory/StackAllocator.hpp"
+
+namespace Engine::Core
+{
+  StackAllocator::StackAllocator( const size reserveBytes )
+    : m_Buffer( reserveBytes )
+    , m_Top( 0 )
+    , m_HighWater( 0 )
+  {
+  }
+
+  StackAllocator::Marker StackAllocator::GetMarker() const
+  {
+    return m_Top;
+  }
+
+  void StackAllocator::Rewind( const Marker marker )
+  {
+    m_Top = std::min( m_Top, marker );
+  }
+
+  void StackAllocator::Trim()
+  {
+    m_Buffer.Decommit( m_Top );
+  }
+
+  size StackAllocator::GetUsed() const
+  {
+    return m_Top;
+  }
+
+  size StackAllocator::GetHighWater() const
+  {
+    return m_HighWater;
+  }
+
+  size StackAllocator::GetCommittedBytes() const
+  {
+    return m_Buffer.GetCommittedSize();
+  }
+
+  void * StackAllocator::do_allocate( const size bytes, const size alignment )
+  {
+    // The buffer is page aligned, so aligning the offset aligns the address.
+    const auto Start = ( m_Top + alignment - 1 ) & ~( alignment - 1 );
+    const auto End   = Start + bytes;
+
+    if ( !m_Buffer.EnsureCommitted( End ) )
+    {
+      throw std::bad_alloc();
+    }
+
+    m_Top       = End;
+    m_HighWater = std::max( m_HighWater, m_Top );
+    return m_Buffer.GetData() + Start;
+  }
+
+  void StackAllocator::do_deallocate( void * pData, const size bytes, size )
+  {
+    // Only the most recent allocation can be popped; the rest wait for Rewind.
+    if ( static_cast<std::byte *>( pData ) + bytes == m_Buffer.GetData() + m_Top )
+    {
+      m_Top -= bytes;
+    }
+  }
+
+  bool StackAllocator::do_is_equal(
+    const std::pmr::memory_resource & other ) const noexcept
+  {
+    return this == &other;
+  }
+} // namespace Engine::Core
@@ -0,0 +1,184 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#if defined( _WIN32 )
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include <algorithm>
+#include <new>
+#include <string>
+
+#include "Engine/Utility/Logger.hpp"
+#include "Engine/Utility/String.hpp"
+
+#include "Engine/Core/Memory/VirtualMemory.hpp"
+
+namespace Engine::Core
+{
+  static std::string DescribeSystemError( const i32 code )
+  {
+#if defined( _WIN32 )
+    return Utility::String::GetWin32Error( static_cast<u32>( code ) );
+#else
+    return std::strerror( code );
+#endif
+  }
+
+  size VirtualMemory::GetPageSize()
+  {
+    static const size s_PageSize = []
+    {
+#if defined( _WIN32 )
+      SYSTEM_INFO info = {};
+      GetSystemInfo( &info );
+      return static_cast<size>( info.dwPageSize );
+#else
+      return static_cast<size>( sysconf( _SC_PAGESIZE ) );
+#endif
+    }();
+
+    return s_PageSize;
+  }
+
+  size VirtualMemory::RoundToPages( const size bytes )
+  {
+    const auto PageSize = GetPageSize();
+    return ( bytes + PageSize - 1 ) & ~( PageSize - 1 );
+  }
+
+  Result<std::byte *> VirtualMemory::Reserve( const size bytes )
+  {
+#if defined( _WIN32 )
+    void * pAddress = VirtualAlloc( nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS );
+    if ( !pAddress )
+    {
+      return Error( "Failed to reserve address space",
+                    static_cast<i32>( GetLastError() ), &DescribeSystemError );
+    }
+#else
+    void * pAddress = mmap( nullptr, bytes, PROT_NONE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+    if ( pAddress == MAP_FAILED )
+    {
+      return Error( "Failed to reserve address space", errno, &DescribeSystemError );
+    }
+#endif
+
+    return static_cast<std::byte *>( pAddress );
+  }
+
+  bool VirtualMemory::Commit( std::byte * pAddress, const size bytes )
+  {
+#if defined( _WIN32 )
+    return VirtualAlloc( pAddress, bytes, MEM_COMMIT, PAGE_READWRITE ) != nullptr;
+#else
+    return mprotect( pAddress, bytes, PROT_READ | PROT_WRITE ) == 0;
+#endif
+  }
+
+  void VirtualMemory::Decommit( std::byte * pAddress, const size bytes )
+  {
+#if defined( _WIN32 )
+    VirtualFree( pAddress, bytes, MEM_DECOMMIT );
+#else
+    // Drop the pages before revoking access so the kernel can reclaim them.
+    madvise( pAddress, bytes, MADV_DONTNEED );
+    mprotect( pAddress, bytes, PROT_NONE );
+#endif
+  }
+
+  void VirtualMemory::Release( std::byte * pAddress, const size bytes )
+  {
+#if defined( _WIN32 )
+    ( void )bytes;
+    VirtualFree( pAddress, 0, MEM_RELEASE );
+#else
+    munmap( pAddress, bytes );
+#endif
+  }
+
+  VirtualBuffer::VirtualBuffer( const size reserveBytes, const bool hasGuardPage )
+    : m_pData( nullptr )
+    , m_Reserved( VirtualMemory::RoundToPages( reserveBytes ) )
+    , m_Committed( 0 )
+    , m_Mapped( m_Reserved + ( hasGuardPage ? VirtualMemory::GetPageSize() : 0 ) )
+  {
+    auto result = VirtualMemory::Reserve( m_Mapped );
+    if ( !result )
+    {
+      LOG_ERROR( "Failed to reserve {} bytes: {}", m_Mapped, result.GetError() );
+      throw std::bad_alloc();
+    }
+
+    m_pData = result.GetValue();
+  }
+
+  VirtualBuffer::~VirtualBuffer()
+  {
+    VirtualMemory::Release( m_pData, m_Mapped );
+  }
+
+  bool VirtualBuffer::EnsureCommitted( const size bytes )
+  {
+    if ( bytes <= m_Committed )
+    {
+      return true;
+    }
+
+    if ( bytes > m_Reserved )
+    {
+      return false;
+    }
+
+    const auto Grown  = std::max( bytes, m_Committed * 2 );
+    const auto Target = std::min( VirtualMemory::RoundToPages( Grown ), m_Reserved );
+    if ( !VirtualMemory::Commit( m_pData + m_Committed, Target - m_Committed ) )
+    {
+      return false;
+    }
+
+    m_Committed = Target;
+    return true;
+  }
+
+  void VirtualBuffer::Decommit( const size keepBytes )
+  {
+    const auto Keep = VirtualMemory::RoundToPages( keepBytes );
+    if ( Keep < m_Committed )
+    {
+      VirtualMemory::Decommit( m_pData + Keep, m_Committed - Keep );
+      m_Committed = Keep;
+    }
+  }
+
+  std::byte * VirtualBuffer::GetData() const
+  {
+    return m_pData;
+  }
+
+  size VirtualBuffer::GetReservedSize() const
+  {
+    return m_Reserved;
+  }
+
+  size VirtualBuffer::GetCommittedSize() const
+  {
+    return m_Committed;
+  }
+} // namespace Engine::Core
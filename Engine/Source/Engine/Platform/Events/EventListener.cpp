@@ -11,7 +11,7 @@ namespace Engine::Platform::Events
     m_Id = m_pWindow->AddEventListener( std::move( callback ) );
     if ( m_Id == 0 )
     {
-      LOG_FATAL( "Failed to add event listener!" );
+      LOG_FATAL_CH( Events, "Failed to add event listener!" );
       m_pWindow = nullptr;
     }
   }
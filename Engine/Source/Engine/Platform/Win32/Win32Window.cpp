@@ -14,6 +14,11 @@
 
 namespace Engine::Platform::Win32
 {
+  static std::string DescribeVulkanResult( const i32 code )
+  {
+    return vk::to_string( static_cast<vk::Result>( code ) );
+  }
+
   bool Win32Window::s_IsClassRegistered = false;
 
   Win32Window::Win32Window( const WindowProps & props )
@@ -46,7 +51,8 @@ namespace Engine::Platform::Win32
     }
     catch ( const vk::SystemError & e )
     {
-      return std::format( "Failed to create Vulkan surface: {}", e.what() );
+      return Error( "Failed to create Vulkan surface",
+                    static_cast<i32>( e.code().value() ), &DescribeVulkanResult );
     }
   }
 
@@ -180,9 +186,11 @@ namespace Engine::Platform::Win32
     m_Data.m_ShouldClose  = false;
     m_pInstance           = GetModuleHandleW( nullptr );
 
-    LOG_INFO( "Creating Win32 window... (title={}, width={}, "
-              "height={}, vsynced={})",
-              m_Data.m_Title, m_Data.m_Width, m_Data.m_Height, m_Data.m_IsVsynced );
+    LOG_INFO_CH( Platform,
+                 "Creating Win32 window... (title={}, width={}, "
+                 "height={}, vsynced={})",
+                 m_Data.m_Title, m_Data.m_Width, m_Data.m_Height,
+                 m_Data.m_IsVsynced );
 
     if ( !s_IsClassRegistered )
     {
@@ -200,7 +208,7 @@ namespace Engine::Platform::Win32
       if ( !RegisterClassExW( &wc ) )
       {
         auto Error = Utility::String::GetLastWin32Error();
-        LOG_FATAL( "Failed to register window class: {}", Error );
+        LOG_FATAL_CH( Platform, "Failed to register window class: {}", Error );
       }
 
       s_IsClassRegistered = true;
@@ -237,7 +245,7 @@ namespace Engine::Platform::Win32
     if ( !m_pHandle )
     {
       const auto Error = Utility::String::GetLastWin32Error();
-      LOG_FATAL( "Failed to create Win32 window: {}", Error );
+      LOG_FATAL_CH( Platform, "Failed to create Win32 window: {}", Error );
     }
 
     GetWindowRect( m_pHandle, &m_Data.m_WindowedRect );
@@ -251,9 +259,11 @@ namespace Engine::Platform::Win32
       SetFullScreen( m_pHandle );
     }
 
-    LOG_INFO( "Successfully created Win32 window (title={}, width ={}, "
-              "height={}, vsynced={})",
-              m_Data.m_Title, m_Data.m_Width, m_Data.m_Height, m_Data.m_IsVsynced );
+    LOG_INFO_CH( Platform,
+                 "Successfully created Win32 window (title={}, width ={}, "
+                 "height={}, vsynced={})",
+                 m_Data.m_Title, m_Data.m_Width, m_Data.m_Height,
+                 m_Data.m_IsVsynced );
   }
 
   LRESULT CALLBACK Win32Window::WindowProc( HWND hWnd, const UINT uMsg,
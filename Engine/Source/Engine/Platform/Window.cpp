@@ -27,14 +27,14 @@ namespace Engine::Platform
   {
     if ( !callback )
     {
-      LOG_WARN( "Attempted to add null event callback!" );
+      LOG_WARN_CH( Platform, "Attempted to add null event callback!" );
       return 0;
     }
 
     u8 id = m_NextListenerId++;
     m_EventListeners.emplace_back( EventListener { id, std::move( callback ) } );
 
-    LOG_INFO( "Added event listener with ID: {}", id );
+    LOG_INFO_CH( Platform, "Added event listener with ID: {}", id );
     return id;
   }
 
@@ -46,18 +46,19 @@ namespace Engine::Platform
 
     if ( I != m_EventListeners.end() )
     {
-      LOG_INFO( "Removed event listener with ID: {}", id );
+      LOG_INFO_CH( Platform, "Removed event listener with ID: {}", id );
       m_EventListeners.erase( I );
       return true;
     }
 
-    LOG_WARN( "Attempted to remove non-existent event listener with ID: {}", id );
+    LOG_WARN_CH( Platform,
+                 "Attempted to remove non-existent event listener with ID: {}", id );
     return false;
   }
 
   void Window::ClearEventListeners()
   {
-    LOG_INFO( "Clearing {} event listeners", m_EventListeners.size() );
+    LOG_INFO_CH( Platform, "Clearing {} event listeners", m_EventListeners.size() );
     m_EventListeners.clear();
   }
 
@@ -71,11 +72,11 @@ namespace Engine::Platform
       }
       catch ( const std::exception & E )
       {
-        LOG_ERROR( "Exception in event listener {}: {}", Id, E.what() );
+        LOG_ERROR_CH( Platform, "Exception in event listener {}: {}", Id, E.what() );
       }
       catch ( ... )
       {
-        LOG_ERROR( "Unknown exception in event listener {}", Id );
+        LOG_ERROR_CH( Platform, "Unknown exception in event listener {}", Id );
       }
     }
   }
@@ -70,7 +70,7 @@ namespace Engine::Renderer
 
     if ( Devices.empty() )
     {
-      LOG_ERROR( "Failed to find a GPU with Vulkan support!" );
+      LOG_ERROR_CH( Renderer, "Failed to find a GPU with Vulkan support!" );
     }
 
     for ( const auto & Device : Devices )
@@ -85,11 +85,11 @@ namespace Engine::Renderer
 
     if ( !*m_pPhysicalDevice )
     {
-      LOG_FATAL( "Failed to find a suitable GPU with Vulkan support!" );
+      LOG_FATAL_CH( Renderer, "Failed to find a suitable GPU with Vulkan support!" );
     }
 
     const auto Properties = m_pPhysicalDevice.getProperties();
-    LOG_INFO( "Selected GPU: {}", Properties.deviceName.data() );
+    LOG_INFO_CH( Renderer, "Selected GPU: {}", Properties.deviceName.data() );
   }
 
   void Device::CreateLogicalDevice( const vk::raii::SurfaceKHR & surface )
@@ -126,7 +126,7 @@ namespace Engine::Renderer
     }
     catch ( const vk::SystemError & E )
     {
-      LOG_FATAL( "Failed to create logical device: {}", E.what() );
+      LOG_FATAL_CH( Renderer, "Failed to create logical device: {}", E.what() );
     }
 
     m_pGraphicsQueue =
@@ -60,13 +60,14 @@ namespace Engine::Renderer
   {
     if ( m_IsFrameStarted )
     {
-      LOG_ERROR( "BeginDraw invalid while draw is in progress!" );
+      LOG_ERROR_CH( Renderer, "BeginDraw invalid while draw is in progress!" );
       return;
     }
 
     if ( m_CurrentFrame >= s_MaxFramesInFlight )
     {
-      LOG_FATAL( "Current frame index out of bounds: {}", m_CurrentFrame );
+      LOG_FATAL_CH( Renderer, "Current frame index out of bounds: {}",
+                    m_CurrentFrame );
       return;
     }
 
@@ -76,7 +77,7 @@ namespace Engine::Renderer
 
     if ( Wait != vk::Result::eSuccess )
     {
-      LOG_ERROR( "Failed to wait for fence!" );
+      LOG_ERROR_RATE_LIMITED_CH( Renderer, 1, "Failed to wait for fence!" );
       return;
     }
 
@@ -91,7 +92,7 @@ namespace Engine::Renderer
 
     if ( First != vk::Result::eSuccess && First != vk::Result::eSuboptimalKHR )
     {
-      LOG_FATAL( "Failed to acquire swap chain image!" );
+      LOG_FATAL_CH( Renderer, "Failed to acquire swap chain image!" );
       return;
     }
 
@@ -99,8 +100,8 @@ namespace Engine::Renderer
 
     if ( m_ImageIndex >= m_pImagesInFlight.size() )
     {
-      LOG_FATAL( "Image index out of bounds: {} >= {}", m_ImageIndex,
-                 m_pImagesInFlight.size() );
+      LOG_FATAL_CH( Renderer, "Image index out of bounds: {} >= {}", m_ImageIndex,
+                    m_pImagesInFlight.size() );
       return;
     }
 
@@ -112,7 +113,7 @@ namespace Engine::Renderer
 
       if ( WaitResult != vk::Result::eSuccess )
       {
-        LOG_ERROR( "Failed to wait for image fence!" );
+        LOG_ERROR_RATE_LIMITED_CH( Renderer, 1, "Failed to wait for image fence!" );
         return;
       }
     }
@@ -147,7 +148,7 @@ namespace Engine::Renderer
   {
     if ( !m_IsFrameStarted )
     {
-      LOG_ERROR( "EndDraw invalid when frame not in progress!" );
+      LOG_ERROR_CH( Renderer, "EndDraw invalid when frame not in progress!" );
       return;
     }
 
@@ -188,7 +189,8 @@ namespace Engine::Renderer
     }
     else if ( Result != vk::Result::eSuccess )
     {
-      LOG_ERROR( "Failed to present swap chain image!" );
+      LOG_ERROR_RATE_LIMITED_CH( Renderer, 1,
+                                 "Failed to present swap chain image!" );
       return;
     }
 
@@ -215,7 +217,7 @@ namespace Engine::Renderer
   {
     if ( s_IsValidationLayerEnabled && !IsValidationLayerSupported() )
     {
-      LOG_WARN( "No validation layers available!" );
+      LOG_WARN_CH( Renderer, "No validation layers available!" );
     }
 
     vk::ApplicationInfo app = {};
@@ -261,7 +263,7 @@ namespace Engine::Renderer
     }
     catch ( const vk::SystemError & E )
     {
-      LOG_FATAL( "Failed to create instance: {}", E.what() );
+      LOG_FATAL_CH( Renderer, "Failed to create instance: {}", E.what() );
     }
   }
 
@@ -285,7 +287,7 @@ namespace Engine::Renderer
       }
       catch ( const vk::SystemError & E )
       {
-        LOG_FATAL( "Failed to set up debug messenger: {}", E.what() );
+        LOG_FATAL_CH( Renderer, "Failed to set up debug messenger: {}", E.what() );
       }
     }
   }
@@ -295,7 +297,7 @@ namespace Engine::Renderer
     const auto Result = m_Window.CreateSurface( *m_pInstance );
     if ( !Result )
     {
-      LOG_ERROR( "Failed to create surface: {}", Result.GetError() );
+      LOG_ERROR_CH( Renderer, "Failed to create surface: {}", Result.GetError() );
       return;
     }
 
@@ -316,7 +318,7 @@ namespace Engine::Renderer
     }
     catch ( const vk::SystemError & E )
     {
-      LOG_FATAL( "Failed to create command pool: {}", E.what() );
+      LOG_FATAL_CH( Renderer, "Failed to create command pool: {}", E.what() );
     }
   }
 
@@ -341,7 +343,7 @@ namespace Engine::Renderer
     }
     catch ( const vk::SystemError & E )
     {
-      LOG_FATAL( "Failed to allocate command buffers: {}", E.what() );
+      LOG_FATAL_CH( Renderer, "Failed to allocate command buffers: {}", E.what() );
     }
   }
 
@@ -361,7 +363,7 @@ namespace Engine::Renderer
 
     if constexpr ( s_MaxFramesInFlight == 0 )
     {
-      LOG_FATAL( "s_MaxFramesInFlight cannot be zero!" );
+      LOG_FATAL_CH( Renderer, "s_MaxFramesInFlight cannot be zero!" );
     }
 
     vk::FenceCreateInfo fence = {};
@@ -378,7 +380,8 @@ namespace Engine::Renderer
       }
       catch ( const vk::SystemError & E )
       {
-        LOG_FATAL( "Failed to create synchronization objects: {}", E.what() );
+        LOG_FATAL_CH( Renderer, "Failed to create synchronization objects: {}",
+                      E.what() );
       }
     }
 
@@ -391,7 +394,7 @@ namespace Engine::Renderer
       }
       catch ( const vk::SystemError & E )
       {
-        LOG_FATAL( "Failed to create render semaphores: {}", E.what() );
+        LOG_FATAL_CH( Renderer, "Failed to create render semaphores: {}", E.what() );
       }
     }
   }
@@ -457,7 +460,8 @@ namespace Engine::Renderer
   {
     if ( severity >= vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning )
     {
-      LOG_WARN( "Validation layer: {}", callbackData->pMessage );
+      LOG_WARN_RATE_LIMITED_CH( Renderer, 10, "Validation layer: {}",
+                                callbackData->pMessage );
     }
 
     return vk::False;
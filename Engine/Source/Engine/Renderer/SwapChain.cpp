@@ -147,7 +147,7 @@ namespace Engine::Renderer
     }
     catch ( const vk::SystemError & E )
     {
-      LOG_FATAL( "Failed to create swap chain: {}", E.what() );
+      LOG_FATAL_CH( Renderer, "Failed to create swap chain: {}", E.what() );
     }
 
     m_Images      = m_pSwapChain.getImages();
@@ -182,7 +182,7 @@ namespace Engine::Renderer
       }
       catch ( const vk::SystemError & E )
       {
-        LOG_FATAL( "Failed to create image views: {}", E.what() );
+        LOG_FATAL_CH( Renderer, "Failed to create image views: {}", E.what() );
       }
     }
   }
@@ -230,7 +230,7 @@ namespace Engine::Renderer
     }
     catch ( const vk::SystemError & E )
     {
-      LOG_FATAL( "Failed to create render pass: {}", E.what() );
+      LOG_FATAL_CH( Renderer, "Failed to create render pass: {}", E.what() );
     }
   }
 
@@ -258,7 +258,7 @@ namespace Engine::Renderer
       }
       catch ( const vk::SystemError & E )
       {
-        LOG_FATAL( "Failed to create framebuffer: {}", E.what() );
+        LOG_FATAL_CH( Renderer, "Failed to create framebuffer: {}", E.what() );
       }
     }
   }
@@ -0,0 +1,83 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "Engine/Utility/InlineString.hpp"
+
+namespace Engine::Utility::String
+{
+  size CompleteUtf8Length( const std::string_view str )
+  {
+    const auto Back = std::min<size>( str.length(), 3 );
+    for ( size i = 1; i <= Back; ++i )
+    {
+      const auto Byte = static_cast<u8>( str[ str.length() - i ] );
+      if ( ( Byte & 0xC0 ) != 0x80 )
+      {
+        const size Needed = Byte >= 0xF0   ? 4
+                            : Byte >= 0xE0 ? 3
+                            : Byte >= 0xC0 ? 2
+                                           : 1;
+        return Needed > i ? str.length() - i : str.length();
+      }
+    }
+
+    return str.length();
+  }
+
+  size AppendTruncated( const std::span<c8> buffer, const size length,
+                        const std::string_view str, bool & isTruncated )
+  {
+    if ( isTruncated )
+    {
+      return length;
+    }
+
+    const auto Remaining = buffer.size() - length;
+    auto       text      = str;
+    if ( text.length() > Remaining )
+    {
+      // Cut at the capacity, then back off to a code point boundary.
+      text        = text.substr( 0, Remaining );
+      text        = text.substr( 0, CompleteUtf8Length( text ) );
+      isTruncated = true;
+    }
+
+    std::memcpy( buffer.data() + length, text.data(), text.length() );
+    return length + text.length();
+  }
+} // namespace Engine::Utility::String
+
+namespace Engine::Utility
+{
+  StringBuilder::StringBuilder( const std::span<c8> buffer )
+    : m_Buffer( buffer )
+  {
+    m_Buffer[ 0 ] = 0;
+  }
+
+  void StringBuilder::Append( const std::string_view str )
+  {
+    m_Length = String::AppendTruncated( GetWritable(), m_Length, str,
+                                        m_IsTruncated );
+    m_Buffer[ m_Length ] = 0;
+  }
+
+  void StringBuilder::Clear()
+  {
+    m_Length      = 0;
+    m_IsTruncated = false;
+    m_Buffer[ 0 ] = 0;
+  }
+} // namespace Engine::Utility
@@ -10,91 +10,324 @@
   The content herein is highly confidential and should be handled accordingly.
  *--------------------------------------------------------------------------------*/
 
-#include <chrono>
-#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Utility/Logging/AsyncLogWriter.hpp"
+#include "Engine/Utility/Logging/ConsoleSink.hpp"
+#include "Engine/Utility/Logging/FlightRecorder.hpp"
+#include "Engine/Utility/Logging/LogRecord.hpp"
 
 #include "Engine/Utility/Logger.hpp"
 
 namespace Engine::Utility
 {
-  Logger::LogSeverity Logger::s_LogSeverity         = LogSeverity::m_Info;
-  bool                Logger::s_IsDebugBreakEnabled = false;
+  std::array<std::atomic<Logger::LogSeverity>, Logger::s_ChannelCount>
+    Logger::s_ChannelSeverities = { LogSeverity::m_Info, LogSeverity::m_Info,
+                                    LogSeverity::m_Info, LogSeverity::m_Info,
+                                    LogSeverity::m_Info };
+
+  std::atomic<Logger::LogSeverity> Logger::s_CaptureSeverity = LogSeverity::m_Trace;
+
+  std::atomic<bool> Logger::s_IsFormattingDeferred = false;
+
+  std::unique_ptr<AsyncLogWriter> Logger::s_pAsyncWriter = nullptr;
+
+  std::mutex                            Logger::s_SinkMutex;
+  std::vector<std::shared_ptr<LogSink>> Logger::s_Sinks = {
+    std::make_shared<ConsoleSink>() };
+
+  std::mutex                          Logger::s_SummaryMutex;
+  std::vector<Logger::PendingSummary> Logger::s_PendingSummaries;
+  std::atomic<bool>                   Logger::s_HasPendingSummaries = false;
 
   void Logger::SetSeverity( const LogSeverity severity )
   {
-    s_LogSeverity = severity;
+    for ( auto & channelSeverity : s_ChannelSeverities )
+    {
+      channelSeverity.store( severity, std::memory_order_relaxed );
+    }
+  }
+
+  void Logger::SetSeverity( const LogChannel channel, const LogSeverity severity )
+  {
+    s_ChannelSeverities[ static_cast<size>( channel ) ].store(
+      severity, std::memory_order_relaxed );
+  }
+
+  Logger::LogSeverity Logger::GetSeverity( const LogChannel channel )
+  {
+    return s_ChannelSeverities[ static_cast<size>( channel ) ].load(
+      std::memory_order_relaxed );
+  }
+
+  void Logger::SetCaptureSeverity( const LogSeverity severity )
+  {
+    s_CaptureSeverity.store( severity, std::memory_order_relaxed );
   }
 
   void Logger::Log( const LogMetadata & metadata, const LogMessage & message )
   {
-    LogImpl( metadata, message );
+    LogRecord record  = {};
+    record.m_Metadata = metadata;
+    record.m_Message  = message.m_FormattedMessage;
+    record.m_Tick     = LogClock::Now();
+    record.m_ThreadId = GetLogThreadId();
+
+    Dispatch( std::move( record ) );
   }
 
-  void Logger::LogImpl( const LogMetadata & metadata,
-                        const LogMessage &  message )
+  void Logger::AddSink( std::shared_ptr<LogSink> pSink )
   {
-    auto pLevelStr  = "";
-    auto pColorCode = "";
+    if ( !pSink )
+    {
+      return;
+    }
+
+    const std::scoped_lock Lock( s_SinkMutex );
+    s_Sinks.push_back( std::move( pSink ) );
+  }
 
-    switch ( metadata.m_Severity )
+  void Logger::RemoveSink( const std::shared_ptr<LogSink> & pSink )
+  {
+    const std::scoped_lock Lock( s_SinkMutex );
+    std::erase( s_Sinks, pSink );
+  }
+
+  void Logger::ClearSinks()
+  {
+    const std::scoped_lock Lock( s_SinkMutex );
+    s_Sinks.clear();
+  }
+
+  void Logger::StartAsync( const AsyncConfig & config )
+  {
+    if ( s_pAsyncWriter )
     {
-      case LogSeverity::m_Trace:
-      {
-        pLevelStr  = "TRACE";
-        pColorCode = "\033[37m";
-        break;
-      }
+      return;
+    }
 
-      case LogSeverity::m_Info:
-      {
-        pLevelStr  = "INFO";
-        pColorCode = "\033[32m";
-        break;
-      }
+    s_pAsyncWriter =
+      std::make_unique<AsyncLogWriter>( config, WriteRecords, FlushSinks );
+
+    s_IsFormattingDeferred.store( config.m_IsFormattingDeferred,
+                                  std::memory_order_relaxed );
+  }
+
+  void Logger::StopAsync()
+  {
+    EmitSuppressedSummaries();
+
+    s_IsFormattingDeferred.store( false, std::memory_order_relaxed );
+
+    // Destroying the writer drains whatever is still queued.
+    s_pAsyncWriter.reset();
+  }
+
+  void Logger::Flush()
+  {
+    EmitSuppressedSummaries();
+
+    if ( s_pAsyncWriter )
+    {
+      s_pAsyncWriter->Flush();
+    }
+
+    FlushSinks();
+  }
+
+  bool Logger::IsAsync()
+  {
+    return s_pAsyncWriter != nullptr;
+  }
+
+  void Logger::QueueSuppressedSummary( const LogSite & site, LogSiteState & state )
+  {
+    const std::scoped_lock Lock( s_SummaryMutex );
+    s_PendingSummaries.push_back( { &site, &state } );
+    s_HasPendingSummaries.store( true, std::memory_order_relaxed );
+  }
+
+  void Logger::CollectSuppressedSummaries( std::vector<LogRecord> & records,
+                                           const bool               isForced )
+  {
+    const auto             Now = LogClock::Now();
+    const std::scoped_lock Lock( s_SummaryMutex );
+
+    std::erase_if( s_PendingSummaries,
+                   [ & ]( const PendingSummary & pending )
+                   {
+                     if ( !isForced && !pending.m_pState->IsRateWindowOver( Now ) )
+                     {
+                       return false;
+                     }
+
+                     // Released first so a suppression racing with the take
+                     // queues the site again instead of being lost.
+                     pending.m_pState->ReleaseSummary();
+                     if ( const auto Count = pending.m_pState->TakeSuppressedCount();
+                          Count > 0 )
+                     {
+                       records.push_back( MakeRecord(
+                         *pending.m_pSite, Now,
+                         std::format( "Suppressed {} messages", Count ) ) );
+                     }
+
+                     return true;
+                   } );
 
-      case LogSeverity::m_Warn:
+    s_HasPendingSummaries.store( !s_PendingSummaries.empty(),
+                                 std::memory_order_relaxed );
+  }
+
+  void Logger::EmitSuppressedSummaries()
+  {
+    if ( !HasPendingSummaries() )
+    {
+      return;
+    }
+
+    std::vector<LogRecord> records;
+    CollectSuppressedSummaries( records, true );
+
+    for ( auto & record : records )
+    {
+      Dispatch( std::move( record ) );
+    }
+  }
+
+  LogRecord Logger::MakeRecord( const LogSite & site, const u64 tick,
+                                std::string && message )
+  {
+    LogRecord record               = {};
+    record.m_Metadata.m_SourceInfo = site.m_SourceInfo;
+    record.m_Metadata.m_Severity   = site.m_Severity;
+    record.m_Metadata.m_IsVerbose  = true;
+    record.m_pSite                 = &site;
+    record.m_Message               = std::move( message );
+    record.m_Tick                  = tick;
+    record.m_ThreadId              = GetLogThreadId();
+
+    return record;
+  }
+
+  void Logger::LogFormatted( const LogSite & site, const u64 tick,
+                             std::string && message )
+  {
+    Dispatch( MakeRecord( site, tick, std::move( message ) ) );
+  }
+
+  void Logger::LogDeferred( const LogSite & site, const u64 tick,
+                            const LogCodec & codec, const LogPayload & payload )
+  {
+    LogRecord record               = {};
+    record.m_Metadata.m_SourceInfo = site.m_SourceInfo;
+    record.m_Metadata.m_Severity   = site.m_Severity;
+    record.m_Metadata.m_IsVerbose  = true;
+    record.m_pSite                 = &site;
+    record.m_pCodec                = &codec;
+    record.m_Payload.m_Size        = payload.m_Size;
+    record.m_Tick                  = tick;
+    record.m_ThreadId              = GetLogThreadId();
+
+    std::memcpy( record.m_Payload.m_Data.data(), payload.m_Data.data(),
+                 payload.m_Size );
+
+    Dispatch( std::move( record ) );
+  }
+
+  void Logger::Capture( const LogSite & site, const LogCodec & codec,
+                        const u64 tick, const LogPayload & payload )
+  {
+    FlightRecorder::Record( site, &codec, tick, payload );
+  }
+
+  void Logger::Capture( const LogSite & site, const u64 tick,
+                        const std::string_view message )
+  {
+    FlightRecorder::Record( site, tick, message );
+  }
+
+  void Logger::Dispatch( LogRecord && record )
+  {
+    if ( s_pAsyncWriter )
+    {
+      s_pAsyncWriter->Push( std::move( record ) );
+    }
+    else
+    {
+      LogImpl( record );
+    }
+  }
+
+  void Logger::Terminate()
+  {
+    Flush();
+    FlightRecorder::Dump();
+
+    DEBUG_BREAK();
+    std::abort();
+  }
+
+  void Logger::LogImpl( const LogRecord & record )
+  {
+    WriteRecords( { &record, 1 } );
+  }
+
+  void Logger::WriteRecords( const std::span<const LogRecord> records )
+  {
+    const std::scoped_lock Lock( s_SinkMutex );
+
+    std::string scratch;
+    bool        isFatal = false;
+
+    for ( const auto & Record : records )
+    {
+      const auto Severity = Record.m_Metadata.m_Severity;
+      isFatal             = isFatal || Severity == LogSeverity::m_Fatal;
+
+      // Resolved at most once, and only if a text sink accepts the record.
+      std::string_view message;
+      bool             isResolved = false;
+
+      for ( const auto & pSink : s_Sinks )
       {
-        pLevelStr  = "WARN";
-        pColorCode = "\033[33m";
-        break;
+        if ( !pSink->ShouldLog( Severity ) )
+        {
+          continue;
+        }
+
+        if ( !isResolved && pSink->IsMessageRequired() )
+        {
+          message    = Record.ResolveMessage( scratch );
+          isResolved = true;
+        }
+
+        pSink->Write( Record, message );
       }
+    }
 
-      case LogSeverity::m_Error:
+    for ( const auto & pSink : s_Sinks )
+    {
+      if ( isFatal )
       {
-        pLevelStr  = "ERROR";
-        pColorCode = "\033[31m";
-        break;
+        pSink->Flush();
       }
-
-      case LogSeverity::m_Fatal:
+      else
       {
-        pLevelStr             = "FATAL";
-        pColorCode            = "\033[35m";
-        s_IsDebugBreakEnabled = true;
-        break;
+        pSink->EndBatch();
       }
     }
+  }
 
-    const auto Now   = std::chrono::system_clock::now();
-    const auto TimeT = std::chrono::system_clock::to_time_t( Now );
-    const auto Ms    = std::chrono::duration_cast<std::chrono::milliseconds>(
-                      Now.time_since_epoch() ) %
-                    1000;
-
-    std::stringstream ss;
-    ss << std::put_time( std::localtime( &TimeT ), "%H:%M:%S" );
-    ss << '.' << std::setfill( '0' ) << std::setw( 3 ) << Ms.count();
-
-    // [HH:MM:SS.mm] [LEVEL] file:line(function) message
-    std::cout << pColorCode << '[' << ss.str() << "] [" << pLevelStr << "] "
-              << metadata.m_SourceInfo.m_pFileName << ':'
-              << metadata.m_SourceInfo.m_Line << "("
-              << metadata.m_SourceInfo.m_pFunctionName << ") "
-              << message.m_FormattedMessage << "\033[0m" << std::endl;
+  void Logger::FlushSinks()
+  {
+    const std::scoped_lock Lock( s_SinkMutex );
 
-    if ( s_IsDebugBreakEnabled )
+    for ( const auto & pSink : s_Sinks )
     {
-      __debugbreak();
+      pSink->Flush();
     }
   }
 } // namespace Engine::Utility
@@ -0,0 +1,191 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <vector>
+
+#include "Engine/Utility/Logging/AsyncLogWriter.hpp"
+
+namespace Engine::Utility
+{
+  // While rate-limited sites wait for their summary the writer polls instead
+  // of sleeping on the signal, so a burst that simply stops is still reported.
+  static constexpr auto s_SummaryPollInterval = std::chrono::milliseconds( 10 );
+
+  AsyncLogWriter::AsyncLogWriter( const Logger::AsyncConfig & config,
+                                  const WriteCallback         callback,
+                                  const FlushCallback         onIdle )
+    : m_Queue( config.m_Capacity )
+    , m_pWriteCallback( callback )
+    , m_pIdleCallback( onIdle )
+    , m_OverflowPolicy( config.m_OverflowPolicy )
+    , m_BatchSize( std::max( config.m_BatchSize, 1u ) )
+    , m_EnqueuedCount( 0 )
+    , m_WrittenCount( 0 )
+    , m_DroppedCount( 0 )
+    , m_TotalDroppedCount( 0 )
+    , m_Signal( 0 )
+    , m_IsRunning( true )
+  {
+    m_Thread = std::thread( [ this ] { Run(); } );
+  }
+
+  AsyncLogWriter::~AsyncLogWriter()
+  {
+    m_IsRunning.store( false, std::memory_order_release );
+    Wake();
+
+    if ( m_Thread.joinable() )
+    {
+      m_Thread.join();
+    }
+  }
+
+  void AsyncLogWriter::Push( LogRecord && record )
+  {
+    // A fatal record is the last thing the process logs, so it always waits
+    // for room regardless of the overflow policy.
+    const auto IsBlocking =
+      m_OverflowPolicy == Logger::LogOverflowPolicy::m_Block ||
+      record.m_Metadata.m_Severity == Logger::LogSeverity::m_Fatal;
+
+    while ( !m_Queue.TryPush( std::move( record ) ) )
+    {
+      if ( IsBlocking )
+      {
+        Wake();
+        std::this_thread::yield();
+        continue;
+      }
+
+      if ( m_OverflowPolicy == Logger::LogOverflowPolicy::m_DropAndCount )
+      {
+        m_DroppedCount.fetch_add( 1, std::memory_order_relaxed );
+      }
+
+      return;
+    }
+
+    m_EnqueuedCount.fetch_add( 1, std::memory_order_release );
+    Wake();
+  }
+
+  void AsyncLogWriter::Flush()
+  {
+    if ( std::this_thread::get_id() == m_Thread.get_id() )
+    {
+      return;
+    }
+
+    const auto Target = m_EnqueuedCount.load( std::memory_order_acquire );
+    Wake();
+
+    auto written = m_WrittenCount.load( std::memory_order_acquire );
+    while ( written < Target )
+    {
+      m_WrittenCount.wait( written, std::memory_order_acquire );
+      written = m_WrittenCount.load( std::memory_order_acquire );
+    }
+  }
+
+  u64 AsyncLogWriter::GetDroppedCount() const
+  {
+    return m_TotalDroppedCount.load( std::memory_order_relaxed ) +
+           m_DroppedCount.load( std::memory_order_relaxed );
+  }
+
+  void AsyncLogWriter::Run()
+  {
+    std::vector<LogRecord> batch;
+    batch.reserve( m_BatchSize + 1 );
+
+    LogRecord record = {};
+
+    bool isIdleFlushPending = false;
+
+    for ( ;; )
+    {
+      const auto Signal = m_Signal.load( std::memory_order_acquire );
+
+      while ( batch.size() < m_BatchSize && m_Queue.TryPop( record ) )
+      {
+        batch.push_back( std::move( record ) );
+      }
+
+      const auto Popped = batch.size();
+
+      if ( Logger::HasPendingSummaries() )
+      {
+        Logger::CollectSuppressedSummaries( batch, false );
+      }
+
+      if ( const auto Dropped =
+             m_DroppedCount.exchange( 0, std::memory_order_relaxed );
+           Dropped > 0 )
+      {
+        m_TotalDroppedCount.fetch_add( Dropped, std::memory_order_relaxed );
+
+        LogRecord & notice             = batch.emplace_back();
+        notice.m_Metadata.m_Severity   = Logger::LogSeverity::m_Warn;
+        notice.m_Metadata.m_SourceInfo = { 0, __FILE__, "AsyncLogWriter::Run" };
+        notice.m_Message  = std::format( "Dropped {} log messages", Dropped );
+        notice.m_Tick     = LogClock::Now();
+        notice.m_ThreadId = GetLogThreadId();
+      }
+
+      if ( !batch.empty() )
+      {
+        m_pWriteCallback( batch );
+        batch.clear();
+        isIdleFlushPending = true;
+
+        if ( Popped > 0 )
+        {
+          m_WrittenCount.fetch_add( Popped, std::memory_order_release );
+          m_WrittenCount.notify_all();
+        }
+
+        continue;
+      }
+
+      if ( isIdleFlushPending )
+      {
+        m_pIdleCallback();
+        isIdleFlushPending = false;
+      }
+
+      if ( !m_IsRunning.load( std::memory_order_acquire ) )
+      {
+        break;
+      }
+
+      if ( Logger::HasPendingSummaries() )
+      {
+        if ( m_Signal.load( std::memory_order_acquire ) == Signal )
+        {
+          std::this_thread::sleep_for( s_SummaryPollInterval );
+        }
+        continue;
+      }
+
+      m_Signal.wait( Signal, std::memory_order_acquire );
+    }
+  }
+
+  void AsyncLogWriter::Wake()
+  {
+    m_Signal.fetch_add( 1, std::memory_order_release );
+    m_Signal.notify_one();
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,174 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "Engine/Utility/Logging/BinaryLogFormat.hpp"
+#include "Engine/Utility/Logging/LogRecord.hpp"
+
+#include "Engine/Utility/Logging/BinaryFileSink.hpp"
+
+namespace Engine::Utility
+{
+  template <typename T> void BinaryFileSink::Put( const T & value )
+  {
+    static_assert( std::is_trivially_copyable_v<T> );
+
+    PutBytes( &value, sizeof( T ) );
+  }
+
+  BinaryFileSink::BinaryFileSink( const std::filesystem::path & path,
+                                  const Logger::LogSeverity     severity )
+    : LogSink( severity )
+    , m_File( path, std::ios::binary | std::ios::trunc )
+    , m_NextSiteId( 1 )
+  {
+    m_Buffer.reserve( s_FlushThreshold );
+    Put( BinaryLogHeader::Make() );
+  }
+
+  BinaryFileSink::~BinaryFileSink()
+  {
+    Flush();
+  }
+
+  void BinaryFileSink::Write( const LogRecord & record, std::string_view )
+  {
+    if ( !IsOpen() )
+    {
+      return;
+    }
+
+    const auto IsPacked =
+      record.m_pCodec && record.m_pSite &&
+      std::ranges::none_of( record.m_pCodec->m_ArgTypes, []( const auto Type )
+                            { return Type == LogArgType::m_Opaque; } );
+
+    const auto SiteId = GetSiteId( record, IsPacked );
+
+    Put( IsPacked ? BinaryLogEntry::m_Record : BinaryLogEntry::m_Text );
+    Put( SiteId );
+    Put( record.m_ThreadId );
+    Put( record.m_Tick );
+
+    if ( IsPacked )
+    {
+      Put( record.m_Payload.m_Size );
+      PutBytes( record.m_Payload.m_Data.data(), record.m_Payload.m_Size );
+    }
+    else
+    {
+      PutString( record.ResolveMessage( m_Scratch ) );
+    }
+
+    if ( m_Buffer.size() >= s_FlushThreshold )
+    {
+      Flush();
+    }
+  }
+
+  void BinaryFileSink::Flush()
+  {
+    if ( m_Buffer.empty() || !IsOpen() )
+    {
+      return;
+    }
+
+    m_File.write( reinterpret_cast<const char *>( m_Buffer.data() ),
+                  static_cast<std::streamsize>( m_Buffer.size() ) );
+    m_File.flush();
+    m_Buffer.clear();
+  }
+
+  bool BinaryFileSink::IsMessageRequired() const
+  {
+    return false;
+  }
+
+  bool BinaryFileSink::IsOpen() const
+  {
+    return m_File.is_open();
+  }
+
+  u32 BinaryFileSink::GetSiteId( const LogRecord & record, const bool isPacked )
+  {
+    const auto & Metadata = record.m_Metadata;
+
+    if ( const auto * pSite = record.m_pSite )
+    {
+      auto & ids = m_Sites[ pSite ];
+      auto & id  = isPacked ? ids.m_RecordId : ids.m_TextId;
+
+      if ( id == 0 )
+      {
+        id = DefineSite( pSite->m_SourceInfo, pSite->m_Severity, pSite->m_Format,
+                         isPacked ? record.m_pCodec->m_ArgTypes
+                                  : std::span<const LogArgType> {} );
+      }
+
+      return id;
+    }
+
+    const auto & [ Line, pFileName, pFunctionName ] = Metadata.m_SourceInfo;
+
+    auto & id =
+      m_MetadataSites[ { pFileName, pFunctionName, Line, Metadata.m_Severity } ];
+
+    if ( id == 0 )
+    {
+      id = DefineSite( Metadata.m_SourceInfo, Metadata.m_Severity, {}, {} );
+    }
+
+    return id;
+  }
+
+  u32 BinaryFileSink::DefineSite( const Logger::SourceInfo &        sourceInfo,
+                                  const Logger::LogSeverity         severity,
+                                  const std::string_view            format,
+                                  const std::span<const LogArgType> argTypes )
+  {
+    const auto Id = m_NextSiteId++;
+
+    Put( BinaryLogEntry::m_Site );
+    Put( Id );
+    Put( severity );
+    Put( sourceInfo.m_Line );
+    Put( static_cast<u8>( argTypes.size() ) );
+    PutBytes( argTypes.data(), argTypes.size() );
+    PutString( sourceInfo.m_pFileName ? sourceInfo.m_pFileName : "" );
+    PutString( sourceInfo.m_pFunctionName ? sourceInfo.m_pFunctionName : "" );
+    PutString( format );
+
+    return Id;
+  }
+
+  void BinaryFileSink::PutBytes( const void * pData, const size length )
+  {
+    if ( length == 0 )
+    {
+      return;
+    }
+
+    const auto Offset = m_Buffer.size();
+
+    m_Buffer.resize( Offset + length );
+    std::memcpy( m_Buffer.data() + Offset, pData, length );
+  }
+
+  void BinaryFileSink::PutString( const std::string_view text )
+  {
+    Put( static_cast<u32>( text.size() ) );
+    PutBytes( text.data(), text.size() );
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,87 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <iostream>
+
+#include "Engine/Utility/Logging/LogRecord.hpp"
+
+#include "Engine/Utility/Logging/ConsoleSink.hpp"
+
+namespace Engine::Utility
+{
+  ConsoleSink::ConsoleSink( const Logger::LogSeverity severity )
+    : LogSink( severity )
+  {
+  }
+
+  void ConsoleSink::Write( const LogRecord & record, const std::string_view message )
+  {
+    auto pColorCode = "";
+
+    switch ( record.m_Metadata.m_Severity )
+    {
+      case Logger::LogSeverity::m_Trace:
+      {
+        pColorCode = "\033[37m";
+        break;
+      }
+
+      case Logger::LogSeverity::m_Info:
+      {
+        pColorCode = "\033[32m";
+        break;
+      }
+
+      case Logger::LogSeverity::m_Warn:
+      {
+        pColorCode = "\033[33m";
+        break;
+      }
+
+      case Logger::LogSeverity::m_Error:
+      {
+        pColorCode = "\033[31m";
+        break;
+      }
+
+      case Logger::LogSeverity::m_Fatal:
+      {
+        pColorCode = "\033[35m";
+        break;
+      }
+    }
+
+    m_Buffer += pColorCode;
+    FormatLine( record, message, m_Buffer );
+    m_Buffer += "\033[0m\n";
+  }
+
+  // Someone is watching the console, so every batch goes out as it arrives.
+  void ConsoleSink::EndBatch()
+  {
+    Flush();
+  }
+
+  void ConsoleSink::Flush()
+  {
+    if ( m_Buffer.empty() )
+    {
+      return;
+    }
+
+    std::cout.write( m_Buffer.data(),
+                     static_cast<std::streamsize>( m_Buffer.size() ) );
+    std::cout.flush();
+
+    m_Buffer.clear();
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,394 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#if defined( _WIN32 )
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <csignal>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "Engine/Utility/Logging/BinaryLogFormat.hpp"
+#include "Engine/Utility/Logging/LogRecord.hpp"
+
+#include "Engine/Utility/Logging/FlightRecorder.hpp"
+
+namespace Engine::Utility
+{
+  struct FlightRecorder::ThreadRing
+  {
+    struct Entry
+    {
+      const Logger::LogSite * m_pSite    = nullptr;
+      const LogCodec *        m_pCodec   = nullptr;
+      u64                     m_Tick     = 0;
+      u32                     m_ThreadId = 0;
+      LogPayload              m_Payload;
+    };
+
+    std::array<Entry, s_Capacity> m_Entries;
+    std::atomic<u64>              m_Head    = 0;
+    std::atomic<bool>             m_IsInUse = true;
+    ThreadRing *                  m_pNext   = nullptr;
+
+    // Only touched while dumping.
+    u64 m_Cursor = 0;
+    u64 m_End    = 0;
+  };
+
+  // Returns the thread's ring to the pool when the thread exits.  The entries
+  // are kept, so a crash shortly after still shows what the thread did.
+  class FlightRecorder::RingLease
+  {
+  public:
+    RingLease()
+      : m_pRing( AcquireRing() )
+    {
+    }
+
+    ~RingLease()
+    {
+      m_pRing->m_IsInUse.store( false, std::memory_order_release );
+    }
+
+    ThreadRing & Get()
+    {
+      return *m_pRing;
+    }
+
+  private:
+    ThreadRing * m_pRing;
+  };
+
+  // Buffered file output built on raw OS calls so it is usable from a signal
+  // handler.
+  class FlightRecorder::DumpWriter
+  {
+  public:
+    explicit DumpWriter( const std::filesystem::path & path )
+    {
+#if defined( _WIN32 )
+      m_pFile = CreateFileW( path.c_str(), GENERIC_WRITE, 0, nullptr,
+                             CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+#else
+      m_File = open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+#endif
+    }
+
+    ~DumpWriter()
+    {
+      Flush();
+
+#if defined( _WIN32 )
+      if ( m_pFile != INVALID_HANDLE_VALUE )
+      {
+        CloseHandle( m_pFile );
+      }
+#else
+      if ( m_File >= 0 )
+      {
+        close( m_File );
+      }
+#endif
+    }
+
+    [[nodiscard]] bool IsOpen() const
+    {
+#if defined( _WIN32 )
+      return m_pFile != INVALID_HANDLE_VALUE;
+#else
+      return m_File >= 0;
+#endif
+    }
+
+    template <typename T> void Put( const T & value )
+    {
+      static_assert( std::is_trivially_copyable_v<T> );
+
+      PutBytes( &value, sizeof( T ) );
+    }
+
+    void PutBytes( const void * pData, size length )
+    {
+      const auto * pBytes = static_cast<const std::byte *>( pData );
+
+      while ( length > 0 )
+      {
+        if ( m_Size == m_Buffer.size() )
+        {
+          Flush();
+        }
+
+        const auto Count = std::min( length, m_Buffer.size() - m_Size );
+
+        std::memcpy( m_Buffer.data() + m_Size, pBytes, Count );
+        m_Size += Count;
+        pBytes += Count;
+        length -= Count;
+      }
+    }
+
+    void PutString( const std::string_view text )
+    {
+      Put( static_cast<u32>( text.size() ) );
+      PutBytes( text.data(), text.size() );
+    }
+
+  private:
+    void Flush()
+    {
+      if ( m_Size == 0 || !IsOpen() )
+      {
+        return;
+      }
+
+#if defined( _WIN32 )
+      DWORD written = 0;
+      WriteFile( m_pFile, m_Buffer.data(), static_cast<DWORD>( m_Size ), &written,
+                 nullptr );
+#else
+      [[maybe_unused]] const auto Written = write( m_File, m_Buffer.data(), m_Size );
+#endif
+
+      m_Size = 0;
+    }
+
+    std::array<std::byte, 4096> m_Buffer;
+    size                        m_Size = 0;
+
+#if defined( _WIN32 )
+    void * m_pFile = INVALID_HANDLE_VALUE;
+#else
+    int m_File = -1;
+#endif
+  };
+
+  std::atomic<FlightRecorder::ThreadRing *> FlightRecorder::s_pRings   = nullptr;
+  std::atomic<bool>                         FlightRecorder::s_IsDumped = false;
+  std::filesystem::path FlightRecorder::s_DumpPath = "Triumph.crash.tlog";
+
+  void FlightRecorder::Record( const Logger::LogSite & site, const LogCodec * pCodec,
+                               const u64 tick, const LogPayload & payload )
+  {
+    auto &     ring  = GetThreadRing();
+    const auto Head  = ring.m_Head.load( std::memory_order_relaxed );
+    auto &     entry = ring.m_Entries[ Head % s_Capacity ];
+
+    entry.m_pSite          = &site;
+    entry.m_pCodec         = pCodec;
+    entry.m_Tick           = tick;
+    entry.m_ThreadId       = GetLogThreadId();
+    entry.m_Payload.m_Size = payload.m_Size;
+
+    std::memcpy( entry.m_Payload.m_Data.data(), payload.m_Data.data(),
+                 payload.m_Size );
+
+    ring.m_Head.store( Head + 1, std::memory_order_release );
+  }
+
+  void FlightRecorder::Record( const Logger::LogSite & site, const u64 tick,
+                               const std::string_view message )
+  {
+    LogPayload payload;
+    payload.m_Size =
+      static_cast<u16>( std::min( message.size(), LogPayload::s_Capacity ) );
+
+    std::memcpy( payload.m_Data.data(), message.data(), payload.m_Size );
+
+    Record( site, nullptr, tick, payload );
+  }
+
+  void FlightRecorder::SetDumpPath( const std::filesystem::path & path )
+  {
+    s_DumpPath = path;
+  }
+
+  bool FlightRecorder::Dump()
+  {
+    if ( s_IsDumped.exchange( true ) )
+    {
+      return false;
+    }
+
+    DumpWriter writer( s_DumpPath );
+    if ( !writer.IsOpen() )
+    {
+      return false;
+    }
+
+    WriteDump( writer );
+    return true;
+  }
+
+  void FlightRecorder::InstallCrashHandlers()
+  {
+#if defined( _WIN32 )
+    SetUnhandledExceptionFilter(
+      []( EXCEPTION_POINTERS * ) -> LONG
+      {
+        Dump();
+        return EXCEPTION_CONTINUE_SEARCH;
+      } );
+
+    std::signal( SIGABRT, HandleSignal );
+#else
+    struct sigaction action = {};
+    action.sa_handler       = HandleSignal;
+    action.sa_flags         = SA_RESETHAND;
+    sigemptyset( &action.sa_mask );
+
+    for ( const auto Signal : { SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL } )
+    {
+      sigaction( Signal, &action, nullptr );
+    }
+#endif
+  }
+
+  FlightRecorder::ThreadRing & FlightRecorder::GetThreadRing()
+  {
+    thread_local RingLease s_Lease;
+
+    return s_Lease.Get();
+  }
+
+  FlightRecorder::ThreadRing * FlightRecorder::AcquireRing()
+  {
+    for ( auto * pRing = s_pRings.load( std::memory_order_acquire ); pRing;
+          pRing        = pRing->m_pNext )
+    {
+      auto isInUse = false;
+      if ( pRing->m_IsInUse.compare_exchange_strong( isInUse, true,
+                                                     std::memory_order_acquire ) )
+      {
+        return pRing;
+      }
+    }
+
+    // #NOTE: Never freed; a crash handler may walk the list during exit.
+    auto * pRing   = new ThreadRing;
+    pRing->m_pNext = s_pRings.load( std::memory_order_relaxed );
+
+    while ( !s_pRings.compare_exchange_weak( pRing->m_pNext, pRing,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed ) )
+    {
+    }
+
+    return pRing;
+  }
+
+  void FlightRecorder::WriteDump( DumpWriter & writer )
+  {
+    writer.Put( BinaryLogHeader::Make() );
+
+    auto * const pRings = s_pRings.load( std::memory_order_acquire );
+
+    // The oldest slot of a full ring may be mid-write, so it is skipped.
+    for ( auto * pRing = pRings; pRing; pRing = pRing->m_pNext )
+    {
+      pRing->m_End    = pRing->m_Head.load( std::memory_order_acquire );
+      pRing->m_Cursor = pRing->m_End >= s_Capacity ? pRing->m_End - s_Capacity + 1
+                                                   : 0;
+    }
+
+    // Merge the rings by tick; every entry gets its own site so the dump needs
+    // no lookup table.
+    for ( u32 id = 1;; ++id )
+    {
+      const ThreadRing::Entry * pNext = nullptr;
+      ThreadRing *              pFrom = nullptr;
+
+      for ( auto * pRing = pRings; pRing; pRing = pRing->m_pNext )
+      {
+        if ( pRing->m_Cursor == pRing->m_End )
+        {
+          continue;
+        }
+
+        const auto & Entry = pRing->m_Entries[ pRing->m_Cursor % s_Capacity ];
+        if ( !pNext || Entry.m_Tick < pNext->m_Tick )
+        {
+          pNext = &Entry;
+          pFrom = pRing;
+        }
+      }
+
+      if ( !pNext )
+      {
+        break;
+      }
+
+      ++pFrom->m_Cursor;
+
+      const auto & [ Line, pFileName, pFunctionName ] =
+        pNext->m_pSite->m_SourceInfo;
+      // Opaque arguments are only meaningful inside the process, so those
+      // records are dumped as text, like a filtered record.
+      const auto IsPacked =
+        pNext->m_pCodec &&
+        std::ranges::none_of( pNext->m_pCodec->m_ArgTypes, []( const auto Type )
+                              { return Type == LogArgType::m_Opaque; } );
+      const auto ArgTypes =
+        IsPacked ? pNext->m_pCodec->m_ArgTypes : std::span<const LogArgType> {};
+
+      writer.Put( BinaryLogEntry::m_Site );
+      writer.Put( id );
+      writer.Put( pNext->m_pSite->m_Severity );
+      writer.Put( Line );
+      writer.Put( static_cast<u8>( ArgTypes.size() ) );
+      writer.PutBytes( ArgTypes.data(), ArgTypes.size() );
+      writer.PutString( pFileName );
+      writer.PutString( pFunctionName );
+      writer.PutString( pNext->m_pSite->m_Format );
+
+      writer.Put( IsPacked ? BinaryLogEntry::m_Record : BinaryLogEntry::m_Text );
+      writer.Put( id );
+      writer.Put( pNext->m_ThreadId );
+      writer.Put( pNext->m_Tick );
+
+      const auto & Payload = pNext->m_Payload;
+
+      if ( IsPacked )
+      {
+        writer.Put( Payload.m_Size );
+        writer.PutBytes( Payload.m_Data.data(), Payload.m_Size );
+      }
+      else if ( pNext->m_pCodec || Payload.m_Size == 0 )
+      {
+        // Opaque payload, or a filtered record whose arguments could not be
+        // packed; the format string is all that can be shown.
+        writer.PutString( pNext->m_pSite->m_Format );
+      }
+      else
+      {
+        writer.PutString( { reinterpret_cast<const c8 *>( Payload.m_Data.data() ),
+                            Payload.m_Size } );
+      }
+    }
+  }
+
+  void FlightRecorder::HandleSignal( const int signal )
+  {
+    Dump();
+
+    // The handler was reset to the default action, so this terminates as if it
+    // had never been installed.
+    std::raise( signal );
+  }
+} // namespace Engine::Utility
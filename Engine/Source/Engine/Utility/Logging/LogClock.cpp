@@ -0,0 +1,77 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <ctime>
+
+#include "Engine/Utility/Logging/LogClock.hpp"
+
+namespace Engine::Utility
+{
+  const std::chrono::system_clock::time_point LogClock::s_SystemAnchor =
+    std::chrono::system_clock::now();
+  const LogClock::Clock::time_point LogClock::s_SteadyAnchor = Clock::now();
+
+  std::chrono::nanoseconds LogClock::ToDuration( const u64 ticks )
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      Clock::duration( static_cast<Clock::rep>( ticks ) ) );
+  }
+
+  std::chrono::system_clock::time_point LogClock::ToSystemTime( const u64 tick )
+  {
+    const Clock::time_point Steady(
+      Clock::duration( static_cast<Clock::rep>( tick ) ) );
+
+    return s_SystemAnchor +
+           std::chrono::duration_cast<std::chrono::system_clock::duration>(
+             Steady - s_SteadyAnchor );
+  }
+
+  void LogTimestampCache::Append( const u64 tick, std::string & out )
+  {
+    const auto Ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      LogClock::ToSystemTime( tick ).time_since_epoch() )
+                      .count();
+    const auto Second    = Ms >= 0 ? Ms / 1000 : ( Ms - 999 ) / 1000;
+    const auto Remainder = static_cast<u32>( Ms - Second * 1000 );
+
+    if ( Second != m_CachedSecond )
+    {
+      const auto TimeT = static_cast<std::time_t>( Second );
+      std::tm    local = {};
+
+#if defined( _WIN32 )
+      localtime_s( &local, &TimeT );
+#else
+      localtime_r( &TimeT, &local );
+#endif
+
+      m_Prefix[ 0 ] = static_cast<char>( '0' + local.tm_hour / 10 );
+      m_Prefix[ 1 ] = static_cast<char>( '0' + local.tm_hour % 10 );
+      m_Prefix[ 2 ] = ':';
+      m_Prefix[ 3 ] = static_cast<char>( '0' + local.tm_min / 10 );
+      m_Prefix[ 4 ] = static_cast<char>( '0' + local.tm_min % 10 );
+      m_Prefix[ 5 ] = ':';
+      m_Prefix[ 6 ] = static_cast<char>( '0' + local.tm_sec / 10 );
+      m_Prefix[ 7 ] = static_cast<char>( '0' + local.tm_sec % 10 );
+
+      m_CachedSecond = Second;
+    }
+
+    const char Millis[] = { '.', static_cast<char>( '0' + Remainder / 100 ),
+                            static_cast<char>( '0' + Remainder / 10 % 10 ),
+                            static_cast<char>( '0' + Remainder % 10 ) };
+
+    out.append( m_Prefix, sizeof( m_Prefix ) );
+    out.append( Millis, sizeof( Millis ) );
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,97 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <bit>
+
+#include "Engine/Utility/Logging/LogQueue.hpp"
+
+namespace Engine::Utility
+{
+  LogQueue::LogQueue( const u32 capacity )
+    : m_pCells( nullptr )
+    , m_Mask( 0 )
+    , m_EnqueuePosition( 0 )
+    , m_DequeuePosition( 0 )
+  {
+    const auto Capacity = std::bit_ceil( std::max( capacity, 2u ) );
+
+    m_pCells = std::make_unique<Cell[]>( Capacity );
+    m_Mask   = Capacity - 1;
+
+    for ( size i = 0; i < Capacity; ++i )
+    {
+      m_pCells[ i ].m_Sequence.store( i, std::memory_order_relaxed );
+    }
+  }
+
+  bool LogQueue::TryPush( LogRecord && record )
+  {
+    Cell * pCell    = nullptr;
+    auto   position = m_EnqueuePosition.load( std::memory_order_relaxed );
+
+    for ( ;; )
+    {
+      pCell = &m_pCells[ position & m_Mask ];
+
+      const auto Sequence = pCell->m_Sequence.load( std::memory_order_acquire );
+      const auto Diff =
+        static_cast<i64>( Sequence ) - static_cast<i64>( position );
+
+      if ( Diff == 0 )
+      {
+        if ( m_EnqueuePosition.compare_exchange_weak( position, position + 1,
+                                                      std::memory_order_relaxed ) )
+        {
+          break;
+        }
+      }
+      else if ( Diff < 0 )
+      {
+        return false;
+      }
+      else
+      {
+        position = m_EnqueuePosition.load( std::memory_order_relaxed );
+      }
+    }
+
+    pCell->m_Record = std::move( record );
+    pCell->m_Sequence.store( position + 1, std::memory_order_release );
+    return true;
+  }
+
+  bool LogQueue::TryPop( LogRecord & record )
+  {
+    auto &     cell     = m_pCells[ m_DequeuePosition & m_Mask ];
+    const auto Sequence = cell.m_Sequence.load( std::memory_order_acquire );
+
+    const auto Diff =
+      static_cast<i64>( Sequence ) - static_cast<i64>( m_DequeuePosition + 1 );
+
+    if ( Diff < 0 )
+    {
+      return false;
+    }
+
+    record = std::move( cell.m_Record );
+    cell.m_Sequence.store( m_DequeuePosition + m_Mask + 1,
+                           std::memory_order_release );
+    ++m_DequeuePosition;
+    return true;
+  }
+
+  u32 LogQueue::GetCapacity() const
+  {
+    return static_cast<u32>( m_Mask + 1 );
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,53 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <atomic>
+#include <format>
+
+#include "Engine/Utility/Logging/LogRecord.hpp"
+
+namespace Engine::Utility
+{
+  std::string_view LogRecord::ResolveMessage( std::string & scratch ) const
+  {
+    if ( !m_pCodec || !m_pSite )
+    {
+      return m_Message;
+    }
+
+    try
+    {
+      scratch = m_pCodec->m_pDecode( m_pSite->m_Format, m_Payload.m_Data.data() );
+    }
+    catch ( const std::format_error & e )
+    {
+      scratch = std::format( "[FORMAT ERROR: {}] Raw format: {}", e.what(),
+                             m_pSite->m_Format );
+    }
+    catch ( ... )
+    {
+      scratch =
+        std::format( "[UNKNOWN FORMAT ERROR] Raw format: {}", m_pSite->m_Format );
+    }
+
+    return scratch;
+  }
+
+  u32 GetLogThreadId()
+  {
+    static std::atomic<u32> s_NextId = 1;
+
+    thread_local const u32 Id = s_NextId.fetch_add( 1, std::memory_order_relaxed );
+
+    return Id;
+  }
+} // namespace Engine::Utility
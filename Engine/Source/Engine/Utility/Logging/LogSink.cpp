@@ -0,0 +1,99 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <iterator>
+
+#include "Engine/Utility/Logging/LogRecord.hpp"
+
+#include "Engine/Utility/Logging/LogSink.hpp"
+
+namespace Engine::Utility
+{
+  LogSink::LogSink( const Logger::LogSeverity severity )
+    : m_Severity( severity )
+  {
+  }
+
+  void LogSink::EndBatch()
+  {
+  }
+
+  void LogSink::Flush()
+  {
+  }
+
+  bool LogSink::IsMessageRequired() const
+  {
+    return true;
+  }
+
+  void LogSink::SetSeverity( const Logger::LogSeverity severity )
+  {
+    m_Severity.store( severity, std::memory_order_relaxed );
+  }
+
+  Logger::LogSeverity LogSink::GetSeverity() const
+  {
+    return m_Severity.load( std::memory_order_relaxed );
+  }
+
+  bool LogSink::ShouldLog( const Logger::LogSeverity severity ) const
+  {
+    return severity >= m_Severity.load( std::memory_order_relaxed );
+  }
+
+  void LogSink::FormatLine( const LogRecord & record, const std::string_view message,
+                            std::string & out )
+  {
+    out += '[';
+    m_TimestampCache.Append( record.m_Tick, out );
+
+    const auto & [ Line, pFileName, pFunctionName ] = record.m_Metadata.m_SourceInfo;
+
+    std::format_to( std::back_inserter( out ), "] [{}] {}:{}({}) {}",
+                    GetSeverityName( record.m_Metadata.m_Severity ), pFileName,
+                    Line, pFunctionName, message );
+  }
+
+  const char * LogSink::GetSeverityName( const Logger::LogSeverity severity )
+  {
+    switch ( severity )
+    {
+      case Logger::LogSeverity::m_Trace:
+      {
+        return "TRACE";
+      }
+
+      case Logger::LogSeverity::m_Info:
+      {
+        return "INFO";
+      }
+
+      case Logger::LogSeverity::m_Warn:
+      {
+        return "WARN";
+      }
+
+      case Logger::LogSeverity::m_Error:
+      {
+        return "ERROR";
+      }
+
+      case Logger::LogSeverity::m_Fatal:
+      {
+        return "FATAL";
+      }
+    }
+
+    return "";
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,65 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+
+#include "Engine/Utility/Logging/RingSink.hpp"
+
+namespace Engine::Utility
+{
+  RingSink::RingSink( const u32 capacity, const Logger::LogSeverity severity )
+    : LogSink( severity )
+    , m_Lines( std::max( capacity, 1u ) )
+    , m_Next( 0 )
+    , m_Count( 0 )
+  {
+  }
+
+  void RingSink::Write( const LogRecord & record, const std::string_view message )
+  {
+    const std::scoped_lock Lock( m_Mutex );
+
+    // Reuse the slot's existing capacity instead of reallocating.
+    auto & line = m_Lines[ m_Next ];
+    line.clear();
+    FormatLine( record, message, line );
+
+    m_Next  = ( m_Next + 1 ) % static_cast<u32>( m_Lines.size() );
+    m_Count = std::min( m_Count + 1, static_cast<u32>( m_Lines.size() ) );
+  }
+
+  std::vector<std::string> RingSink::GetLines() const
+  {
+    const std::scoped_lock Lock( m_Mutex );
+
+    const auto Capacity = static_cast<u32>( m_Lines.size() );
+    const auto First    = ( m_Next + Capacity - m_Count ) % Capacity;
+
+    std::vector<std::string> lines;
+    lines.reserve( m_Count );
+
+    for ( u32 i = 0; i < m_Count; ++i )
+    {
+      lines.push_back( m_Lines[ ( First + i ) % Capacity ] );
+    }
+
+    return lines;
+  }
+
+  void RingSink::Clear()
+  {
+    const std::scoped_lock Lock( m_Mutex );
+
+    m_Next  = 0;
+    m_Count = 0;
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,216 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#if defined( _WIN32 )
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+#include "Engine/Utility/Logging/LogRecord.hpp"
+
+#include "Engine/Utility/Logging/RotatingFileSink.hpp"
+
+namespace Engine::Utility
+{
+  RotatingFileSink::RotatingFileSink( const Config &            config,
+                                      const Logger::LogSeverity severity )
+    : LogSink( severity )
+    , m_Config( config )
+    , m_pView( nullptr )
+    , m_Offset( 0 )
+#if defined( _WIN32 )
+    , m_pFile( INVALID_HANDLE_VALUE )
+    , m_pMapping( nullptr )
+#else
+    , m_File( -1 )
+#endif
+  {
+    m_Config.m_SegmentSize = std::max<u64>( m_Config.m_SegmentSize, 4096 );
+    m_Config.m_MaxFiles    = std::max( m_Config.m_MaxFiles, 1u );
+
+    OpenSegment();
+  }
+
+  RotatingFileSink::~RotatingFileSink()
+  {
+    CloseSegment();
+  }
+
+  void RotatingFileSink::Write( const LogRecord & record,
+                                const std::string_view message )
+  {
+    m_Line.clear();
+    FormatLine( record, message, m_Line );
+    m_Line += '\n';
+
+    if ( m_pView && m_Offset + m_Line.size() > m_Config.m_SegmentSize )
+    {
+      Rotate();
+    }
+
+    Append( m_Line );
+  }
+
+  bool RotatingFileSink::IsOpen() const
+  {
+    return m_pView != nullptr;
+  }
+
+  bool RotatingFileSink::OpenSegment()
+  {
+    const auto Size = m_Config.m_SegmentSize;
+
+    m_Offset = 0;
+
+#if defined( _WIN32 )
+    m_pFile = CreateFileW( m_Config.m_Path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                           FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                           FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( m_pFile == INVALID_HANDLE_VALUE )
+    {
+      return false;
+    }
+
+    // Creating the mapping grows the file to the full segment size.
+    m_pMapping = CreateFileMappingW( m_pFile, nullptr, PAGE_READWRITE,
+                                     static_cast<DWORD>( Size >> 32 ),
+                                     static_cast<DWORD>( Size ), nullptr );
+    if ( !m_pMapping )
+    {
+      CloseSegment();
+      return false;
+    }
+
+    m_pView = static_cast<std::byte *>( MapViewOfFile(
+      m_pMapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>( Size ) ) );
+#else
+    m_File = open( m_Config.m_Path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+    if ( m_File < 0 )
+    {
+      return false;
+    }
+
+    if ( posix_fallocate( m_File, 0, static_cast<off_t>( Size ) ) != 0 &&
+         ftruncate( m_File, static_cast<off_t>( Size ) ) != 0 )
+    {
+      CloseSegment();
+      return false;
+    }
+
+    void * pView =
+      mmap( nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, m_File, 0 );
+    m_pView = pView == MAP_FAILED ? nullptr : static_cast<std::byte *>( pView );
+#endif
+
+    if ( !m_pView )
+    {
+      CloseSegment();
+      return false;
+    }
+
+    return true;
+  }
+
+  void RotatingFileSink::CloseSegment()
+  {
+#if defined( _WIN32 )
+    if ( m_pView )
+    {
+      FlushViewOfFile( m_pView, static_cast<SIZE_T>( m_Offset ) );
+      UnmapViewOfFile( m_pView );
+    }
+
+    if ( m_pMapping )
+    {
+      CloseHandle( m_pMapping );
+    }
+
+    if ( m_pFile != INVALID_HANDLE_VALUE )
+    {
+      // Trim the preallocated tail so readers don't see trailing zeros.
+      LARGE_INTEGER end = {};
+      end.QuadPart      = static_cast<LONGLONG>( m_Offset );
+      SetFilePointerEx( m_pFile, end, nullptr, FILE_BEGIN );
+      SetEndOfFile( m_pFile );
+      CloseHandle( m_pFile );
+    }
+
+    m_pFile    = INVALID_HANDLE_VALUE;
+    m_pMapping = nullptr;
+#else
+    if ( m_pView )
+    {
+      munmap( m_pView, m_Config.m_SegmentSize );
+    }
+
+    if ( m_File >= 0 )
+    {
+      // Trim the preallocated tail so readers don't see trailing zeros.
+      [[maybe_unused]] const auto Result =
+        ftruncate( m_File, static_cast<off_t>( m_Offset ) );
+      close( m_File );
+    }
+
+    m_File = -1;
+#endif
+
+    m_pView = nullptr;
+  }
+
+  void RotatingFileSink::Rotate()
+  {
+    CloseSegment();
+
+    std::error_code error;
+    std::filesystem::remove( GetRotatedPath( m_Config.m_MaxFiles ), error );
+
+    for ( auto i = m_Config.m_MaxFiles; i > 1; --i )
+    {
+      std::filesystem::rename( GetRotatedPath( i - 1 ), GetRotatedPath( i ), error );
+    }
+
+    std::filesystem::rename( m_Config.m_Path, GetRotatedPath( 1 ), error );
+
+    OpenSegment();
+  }
+
+  void RotatingFileSink::Append( const std::string_view text )
+  {
+    if ( !m_pView )
+    {
+      return;
+    }
+
+    // A single line larger than a whole segment is truncated.
+    const auto Length =
+      std::min<u64>( text.size(), m_Config.m_SegmentSize - m_Offset );
+
+    std::memcpy( m_pView + m_Offset, text.data(), static_cast<size>( Length ) );
+    m_Offset += Length;
+  }
+
+  std::filesystem::path RotatingFileSink::GetRotatedPath( const u32 index ) const
+  {
+    auto path = m_Config.m_Path;
+    path.replace_filename( std::format( "{}.{}{}",
+                                        m_Config.m_Path.stem().string(), index,
+                                        m_Config.m_Path.extension().string() ) );
+    return path;
+  }
+} // namespace Engine::Utility
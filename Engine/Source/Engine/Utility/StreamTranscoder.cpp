@@ -0,0 +1,181 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+
+#include "Engine/Utility/StreamTranscoder.hpp"
+
+namespace Engine::Utility::String
+{
+  // Units in the sequence a lead unit starts.  Invalid leads count as complete so
+  // the validator reports them.
+  template <typename In> static size SequenceLength( const In lead )
+  {
+    if constexpr ( sizeof( In ) == 1 )
+    {
+      const auto Byte = static_cast<u8>( lead );
+      return Byte >= 0xF0 ? 4 : Byte >= 0xE0 ? 3 : Byte >= 0xC0 ? 2 : 1;
+    }
+    else if constexpr ( sizeof( In ) == 2 )
+    {
+      return lead >= 0xD800 && lead <= 0xDBFF ? 2 : 1;
+    }
+    else
+    {
+      return 1;
+    }
+  }
+
+  template <typename In> static bool IsContinuation( const In unit )
+  {
+    if constexpr ( sizeof( In ) == 1 )
+    {
+      return ( static_cast<u8>( unit ) & 0xC0 ) == 0x80;
+    }
+    else
+    {
+      return unit >= 0xDC00 && unit <= 0xDFFF;
+    }
+  }
+
+  // Length of the chunk without a trailing incomplete sequence.
+  template <typename In>
+  static size CompleteLength( const std::basic_string_view<In> chunk )
+  {
+    if constexpr ( sizeof( In ) == 4 )
+    {
+      return chunk.length();
+    }
+    else
+    {
+      const auto Back = std::min<size>( chunk.length(), sizeof( In ) == 1 ? 3 : 1 );
+      for ( size i = 1; i <= Back; ++i )
+      {
+        const auto Lead = chunk[ chunk.length() - i ];
+        if ( !IsContinuation( Lead ) )
+        {
+          return SequenceLength( Lead ) > i ? chunk.length() - i : chunk.length();
+        }
+      }
+
+      return chunk.length();
+    }
+  }
+
+  template <typename In, typename Out>
+  static TranscodeResult Append( const std::basic_string_view<In> input,
+                                 std::basic_string<Out> &         out )
+  {
+    if constexpr ( sizeof( Out ) == 1 )
+    {
+      return AppendUtf8( input, out );
+    }
+    else if constexpr ( sizeof( Out ) == 2 )
+    {
+      return AppendUtf16( input, out );
+    }
+    else
+    {
+      return AppendUtf32( input, out );
+    }
+  }
+
+  // Unlike the whole-string append, a stream keeps the valid prefix.
+  template <typename In, typename Out>
+  static TranscodeResult AppendValid( const std::basic_string_view<In> input,
+                                      std::basic_string<Out> &         out )
+  {
+    const auto Result = Append( input, out );
+    if ( Result.IsOk() )
+    {
+      return Result;
+    }
+
+    return { TranscodeStatus::m_InvalidInput, Result.m_Read,
+             Append( input.substr( 0, Result.m_Read ), out ).m_Written };
+  }
+
+  template <typename In, typename Out>
+  TranscodeResult StreamTranscoder<In, Out>::Feed( std::basic_string_view<In> chunk,
+                                                   std::basic_string<Out> &   out )
+  {
+    size read    = 0;
+    size written = 0;
+
+    if ( m_PendingLength != 0 )
+    {
+      const auto Needed = SequenceLength( m_Pending[ 0 ] );
+      while ( m_PendingLength < Needed && read < chunk.length() )
+      {
+        if ( !IsContinuation( chunk[ read ] ) )
+        {
+          m_PendingLength = 0;
+          return { TranscodeStatus::m_InvalidInput, 0, 0 };
+        }
+
+        m_Pending[ m_PendingLength++ ] = chunk[ read++ ];
+      }
+
+      if ( m_PendingLength < Needed )
+      {
+        return { TranscodeStatus::m_Ok, read, 0 };
+      }
+
+      const auto Result = Append(
+        std::basic_string_view<In> { m_Pending.data(), Needed }, out );
+      m_PendingLength = 0;
+      if ( !Result.IsOk() )
+      {
+        return { TranscodeStatus::m_InvalidInput, 0, 0 };
+      }
+
+      written = Result.m_Written;
+      chunk.remove_prefix( read );
+    }
+
+    const auto Complete = CompleteLength( chunk );
+    const auto Result   = AppendValid( chunk.substr( 0, Complete ), out );
+    if ( !Result.IsOk() )
+    {
+      return { TranscodeStatus::m_InvalidInput, read + Result.m_Read,
+               written + Result.m_Written };
+    }
+
+    for ( size i = Complete; i < chunk.length(); ++i )
+    {
+      m_Pending[ m_PendingLength++ ] = chunk[ i ];
+    }
+
+    return { TranscodeStatus::m_Ok, read + chunk.length(),
+             written + Result.m_Written };
+  }
+
+  template <typename In, typename Out>
+  TranscodeResult StreamTranscoder<In, Out>::Finish()
+  {
+    const auto IsComplete = m_PendingLength == 0;
+    m_PendingLength       = 0;
+    return { IsComplete ? TranscodeStatus::m_Ok : TranscodeStatus::m_InvalidInput };
+  }
+
+  template <typename In, typename Out> void StreamTranscoder<In, Out>::Reset()
+  {
+    m_PendingLength = 0;
+  }
+
+  template class StreamTranscoder<c8, c16>;
+  template class StreamTranscoder<c8, c32>;
+  template class StreamTranscoder<c16, c8>;
+  template class StreamTranscoder<c16, c32>;
+  template class StreamTranscoder<c32, c8>;
+  template class StreamTranscoder<c32, c16>;
+} // namespace Engine::Utility::String
@@ -14,75 +14,170 @@
 #include <Windows.h>
 #endif
 
+#include "Engine/Utility/Unicode/UnicodeKernels.hpp"
+
 #include "Engine/Utility/String.hpp"
 
 namespace Engine::Utility::String
 {
-  std::string ToUtf8( const std::u16string_view utf16Str )
-  {
-    if ( utf16Str.empty() )
+  // One conversion direction.  m_pStep measures a single code point of valid
+  // input: it returns the input units read and adds the output units needed.
+  template <typename In, typename Out> struct Transcoder
+  {
+    bool ( *m_pIsValid )( std::basic_string_view<In> )        = nullptr;
+    size ( *m_pValidLength )( std::basic_string_view<In> )    = nullptr;
+    size ( *m_pLength )( std::basic_string_view<In> )         = nullptr;
+    size ( *m_pConvert )( std::basic_string_view<In>, Out * ) = nullptr;
+    size ( *m_pStep )( const In * pData, size & units )       = nullptr;
+  };
+
+  static Transcoder<c16, c8> Utf16ToUtf8()
+  {
+    const auto & Kernels = Unicode::GetUnicodeKernels();
+    return { Kernels.m_pIsUtf16, &Unicode::Scalar::ValidUtf16Length,
+             Kernels.m_pUtf8LengthFromUtf16, Kernels.m_pConvertUtf16ToUtf8,
+             []( const c16 * pData, size & units ) -> size
+             {
+               const auto Unit = pData[ 0 ];
+               if ( Unit >= 0xD800 && Unit <= 0xDBFF )
+               {
+                 units += 4;
+                 return 2;
+               }
+
+               units += Unit < 0x80 ? 1 : Unit < 0x800 ? 2 : 3;
+               return 1;
+             } };
+  }
+
+  static Transcoder<c32, c8> Utf32ToUtf8()
+  {
+    const auto & Kernels = Unicode::GetUnicodeKernels();
+    return { Kernels.m_pIsUtf32, &Unicode::Scalar::ValidUtf32Length,
+             Kernels.m_pUtf8LengthFromUtf32, Kernels.m_pConvertUtf32ToUtf8,
+             []( const c32 * pData, size & units ) -> size
+             {
+               const auto CodePoint = pData[ 0 ];
+               units += CodePoint < 0x80      ? 1
+                        : CodePoint < 0x800   ? 2
+                        : CodePoint < 0x10000 ? 3
+                                              : 4;
+               return 1;
+             } };
+  }
+
+  static Transcoder<c8, c16> Utf8ToUtf16()
+  {
+    const auto & Kernels = Unicode::GetUnicodeKernels();
+    return { Kernels.m_pIsUtf8, &Unicode::Scalar::ValidUtf8Length,
+             Kernels.m_pUtf16LengthFromUtf8, Kernels.m_pConvertUtf8ToUtf16,
+             []( const c8 * pData, size & units ) -> size
+             {
+               const auto Byte = static_cast<u8>( pData[ 0 ] );
+               units          += Byte >= 0xF0 ? 2 : 1;
+               return Byte < 0x80 ? 1 : Byte < 0xE0 ? 2 : Byte < 0xF0 ? 3 : 4;
+             } };
+  }
+
+  static Transcoder<c32, c16> Utf32ToUtf16()
+  {
+    const auto & Kernels = Unicode::GetUnicodeKernels();
+    return { Kernels.m_pIsUtf32, &Unicode::Scalar::ValidUtf32Length,
+             &Unicode::Scalar::Utf16LengthFromUtf32,
+             &Unicode::Scalar::ConvertUtf32ToUtf16,
+             []( const c32 * pData, size & units ) -> size
+             {
+               units += pData[ 0 ] > 0xFFFF ? 2 : 1;
+               return 1;
+             } };
+  }
+
+  static Transcoder<c8, c32> Utf8ToUtf32()
+  {
+    const auto & Kernels = Unicode::GetUnicodeKernels();
+    return { Kernels.m_pIsUtf8, &Unicode::Scalar::ValidUtf8Length,
+             Kernels.m_pUtf32LengthFromUtf8, Kernels.m_pConvertUtf8ToUtf32,
+             []( const c8 * pData, size & units ) -> size
+             {
+               const auto Byte  = static_cast<u8>( pData[ 0 ] );
+               units           += 1;
+               return Byte < 0x80 ? 1 : Byte < 0xE0 ? 2 : Byte < 0xF0 ? 3 : 4;
+             } };
+  }
+
+  static Transcoder<c16, c32> Utf16ToUtf32()
+  {
+    const auto & Kernels = Unicode::GetUnicodeKernels();
+    return { Kernels.m_pIsUtf16, &Unicode::Scalar::ValidUtf16Length,
+             &Unicode::Scalar::Utf32LengthFromUtf16,
+             &Unicode::Scalar::ConvertUtf16ToUtf32,
+             []( const c16 * pData, size & units ) -> size
+             {
+               units += 1;
+               return pData[ 0 ] >= 0xD800 && pData[ 0 ] <= 0xDBFF ? 2 : 1;
+             } };
+  }
+
+  template <typename In, typename Out>
+  static TranscodeResult TranscodeInto( const Transcoder<In, Out> &      transcoder,
+                                        const std::basic_string_view<In> input,
+                                        const std::span<Out>             out )
+  {
+    const auto ValidLength = transcoder.m_pIsValid( input )
+                               ? input.length()
+                               : transcoder.m_pValidLength( input );
+
+    auto prefix = input.substr( 0, ValidLength );
+    auto status = ValidLength == input.length() ? TranscodeStatus::m_Ok
+                                                : TranscodeStatus::m_InvalidInput;
+
+    // Rare path: walk code points to find the longest prefix that fits.
+    if ( transcoder.m_pLength( prefix ) > out.size() )
     {
-      return {};
-    }
-
-    std::string result;
-    result.reserve( utf16Str.length() * 3 );
-
-    for ( size i = 0; i < utf16Str.length(); /**/ )
-    {
-      const auto Unit1     = utf16Str[ i ];
-      u32        codePoint = 0;
-
-      if ( Unit1 < 0xD800 || Unit1 > 0xDFFF )
-      {
-        codePoint  = Unit1;
-        i         += 1;
-      }
-      else if ( Unit1 >= 0xD800 && Unit1 <= 0xDBFF )
+      size read    = 0;
+      size written = 0;
+      while ( read < prefix.length() )
       {
-        if ( i + 1 >= utf16Str.length() )
+        size       units = written;
+        const auto Read  = transcoder.m_pStep( prefix.data() + read, units );
+        if ( units > out.size() )
         {
-          return {};
+          break;
         }
 
-        const auto Unit2 = utf16Str[ i + 1 ];
-        if ( Unit2 < 0xDC00 || Unit2 > 0xDFFF )
-        {
-          return {};
-        }
-
-        codePoint  = 0x10000 + ( ( Unit1 & 0x3FF ) << 10 ) + ( Unit2 & 0x3FF );
-        i         += 2;
-      }
-      else
-      {
-        return {};
+        read    += Read;
+        written  = units;
       }
 
-      if ( codePoint <= 0x7F )
-      {
-        result.push_back( static_cast<c8>( codePoint ) );
-      }
-      else if ( codePoint <= 0x7FF )
-      {
-        result.push_back( static_cast<c8>( 0xC0 | codePoint >> 6 ) );
-        result.push_back( static_cast<c8>( 0x80 | codePoint & 0x3F ) );
-      }
-      else if ( codePoint <= 0xFFFF )
-      {
-        result.push_back( static_cast<c8>( 0xE0 | codePoint >> 12 ) );
-        result.push_back( static_cast<c8>( 0x80 | codePoint >> 6 & 0x3F ) );
-        result.push_back( static_cast<c8>( 0x80 | codePoint & 0x3F ) );
-      }
-      else
-      {
-        result.push_back( static_cast<c8>( 0xF0 | codePoint >> 18 ) );
-        result.push_back( static_cast<c8>( 0x80 | codePoint >> 12 & 0x3F ) );
-        result.push_back( static_cast<c8>( 0x80 | codePoint >> 6 & 0x3F ) );
-        result.push_back( static_cast<c8>( 0x80 | codePoint & 0x3F ) );
-      }
+      prefix = prefix.substr( 0, read );
+      status = TranscodeStatus::m_OutputTooSmall;
+    }
+
+    return { status, prefix.length(),
+             transcoder.m_pConvert( prefix, out.data() ) };
+  }
+
+  template <typename In, typename Out>
+  static TranscodeResult AppendTo( const Transcoder<In, Out> &      transcoder,
+                                   const std::basic_string_view<In> input,
+                                   std::basic_string<Out> &         str )
+  {
+    if ( !transcoder.m_pIsValid( input ) )
+    {
+      return { TranscodeStatus::m_InvalidInput, transcoder.m_pValidLength( input ),
+               0 };
     }
 
+    const auto Offset = str.size();
+    str.resize( Offset + transcoder.m_pLength( input ) );
+    return { TranscodeStatus::m_Ok, input.length(),
+             transcoder.m_pConvert( input, str.data() + Offset ) };
+  }
+
+  std::string ToUtf8( const std::u16string_view utf16Str )
+  {
+    std::string result;
+    AppendUtf8( utf16Str, result );
     return result;
   }
 
@@ -98,46 +193,8 @@ namespace Engine::Utility::String
 
   std::string ToUtf8( const std::u32string_view utf32Str )
   {
-    if ( utf32Str.empty() )
-    {
-      return {};
-    }
-
     std::string result;
-    result.reserve( utf32Str.length() * 4 );
-
-    for ( const auto CodePoint : utf32Str )
-    {
-      if ( CodePoint > 0x10FFFF || ( CodePoint >= 0xD800 && CodePoint <= 0xDFFF ) )
-      {
-        return {};
-      }
-
-      if ( CodePoint <= 0x7F )
-      {
-        result.push_back( static_cast<c8>( CodePoint ) );
-      }
-      else if ( CodePoint <= 0x7FF )
-      {
-        result.push_back( static_cast<c8>( 0xC0 | CodePoint >> 6 ) );
-        result.push_back( static_cast<c8>( 0x80 | CodePoint & 0x3F ) );
-      }
-      else if ( CodePoint <= 0xFFFF )
-
-      {
-        result.push_back( static_cast<c8>( 0xE0 | CodePoint >> 12 ) );
-        result.push_back( static_cast<c8>( 0x80 | CodePoint >> 6 & 0x3F ) );
-        result.push_back( static_cast<c8>( 0x80 | CodePoint & 0x3F ) );
-      }
-      else
-      {
-        result.push_back( static_cast<c8>( 0xF0 | CodePoint >> 18 ) );
-        result.push_back( static_cast<c8>( 0x80 | CodePoint >> 12 & 0x3F ) );
-        result.push_back( static_cast<c8>( 0x80 | CodePoint >> 6 & 0x3F ) );
-        result.push_back( static_cast<c8>( 0x80 | CodePoint & 0x3F ) );
-      }
-    }
-
+    AppendUtf8( utf32Str, result );
     return result;
   }
 
@@ -153,109 +210,8 @@ namespace Engine::Utility::String
 
   std::u16string ToUtf16( const std::string_view str )
   {
-    if ( str.empty() )
-    {
-      return {};
-    }
-
     std::u16string result;
-    result.reserve( str.length() );
-
-    for ( size i = 0; i < str.length(); /**/ )
-    {
-      const auto Byte1     = static_cast<u8>( str[ i ] );
-      u32        codePoint = 0;
-
-      if ( Byte1 < 0x80 )
-      {
-        codePoint  = Byte1;
-        i         += 1;
-      }
-      else if ( Byte1 >> 5 == 0b110 )
-      {
-        if ( i + 1 >= str.length() )
-        {
-          return {};
-        }
-
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 )
-        {
-          return {};
-        }
-
-        codePoint = ( Byte1 & 0x1F ) << 6 | Byte2 & 0x3F;
-        if ( codePoint < 0x80 )
-        {
-          return {};
-        }
-
-        i += 2;
-      }
-      else if ( Byte1 >> 4 == 0b1110 )
-      {
-        if ( i + 2 >= str.length() )
-        {
-          return {};
-        }
-
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 )
-        {
-          return {};
-        }
-
-        codePoint = ( Byte1 & 0xF ) << 12 | ( Byte2 & 0x3F ) << 6 | Byte3 & 0x3F;
-        if ( codePoint < 0x800 || ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) )
-        {
-          return {};
-        }
-
-        i += 3;
-      }
-      else if ( Byte1 >> 3 == 0b11110 )
-      {
-        if ( i + 3 >= str.length() )
-        {
-          return {};
-        }
-
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
-        const auto Byte4 = static_cast<u8>( str[ i + 3 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 ||
-             ( Byte4 & 0xC0 ) != 0x80 )
-        {
-          return {};
-        }
-
-        codePoint = ( Byte1 & 0x07 ) << 18 | ( Byte2 & 0x3F ) << 12 |
-                    ( Byte3 & 0x3F ) << 6 | Byte4 & 0x3F;
-        if ( codePoint < 0x10000 || codePoint > 0x10FFFF )
-        {
-          return {};
-        }
-
-        i += 4;
-      }
-      else
-      {
-        return {};
-      }
-
-      if ( codePoint <= 0xFFFF )
-      {
-        result.push_back( static_cast<c16>( codePoint ) );
-      }
-      else
-      {
-        codePoint -= 0x10000;
-        result.push_back( static_cast<c16>( 0xD800 + ( codePoint >> 10 ) ) );
-        result.push_back( static_cast<c16>( 0xDC00 + ( codePoint & 0x3FF ) ) );
-      }
-    }
-
+    AppendUtf16( str, result );
     return result;
   }
 
@@ -271,132 +227,15 @@ namespace Engine::Utility::String
 
   std::u16string ToUtf16( const std::u32string_view utf32Str )
   {
-    if ( utf32Str.empty() )
-    {
-      return {};
-    }
-
     std::u16string result;
-    result.reserve( utf32Str.length() * 2 );
-
-    for ( auto codePoint : utf32Str )
-    {
-      if ( codePoint > 0x10FFFF || ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) )
-      {
-        return {};
-      }
-
-      if ( codePoint <= 0xFFFF )
-      {
-        result.push_back( static_cast<c16>( codePoint ) );
-      }
-      else
-      {
-        codePoint -= 0x10000;
-        result.push_back( static_cast<c16>( 0xD800 + ( codePoint >> 10 ) ) );
-        result.push_back( static_cast<c16>( 0xDC00 + ( codePoint & 0x3FF ) ) );
-      }
-    }
-
+    AppendUtf16( utf32Str, result );
     return result;
   }
 
   std::u32string ToUtf32( const std::string_view str )
   {
-    if ( str.empty() )
-    {
-      return {};
-    }
-
     std::u32string result;
-    result.reserve( str.length() );
-
-    for ( size i = 0; i < str.length(); /**/ )
-    {
-      const auto Byte1     = static_cast<u8>( str[ i ] );
-      u32        codePoint = 0;
-
-      if ( Byte1 < 0x80 )
-      {
-        codePoint  = Byte1;
-        i         += 1;
-      }
-      else if ( Byte1 >> 5 == 0b110 )
-      {
-        if ( i + 1 >= str.length() )
-        {
-          return {};
-        }
-
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 )
-        {
-          return {};
-        }
-
-        codePoint = ( Byte1 & 0x1F ) << 6 | Byte2 & 0x3F;
-        if ( codePoint < 0x80 )
-        {
-          return {};
-        }
-
-        i += 2;
-      }
-      else if ( Byte1 >> 4 == 0b1110 )
-      {
-        if ( i + 2 >= str.length() )
-        {
-          return {};
-        }
-
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 )
-        {
-          return {};
-        }
-
-        codePoint = ( Byte1 & 0x0F ) << 12 | ( Byte2 & 0x3F ) << 6 | Byte3 & 0x3F;
-        if ( codePoint < 0x800 || ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) )
-        {
-          return {};
-        }
-
-        i += 3;
-      }
-      else if ( Byte1 >> 3 == 0b11110 )
-      {
-        if ( i + 3 >= str.length() )
-        {
-          return {};
-        }
-
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
-        const auto Byte4 = static_cast<u8>( str[ i + 3 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 ||
-             ( Byte4 & 0xC0 ) != 0x80 )
-        {
-          return {};
-        }
-
-        codePoint = ( Byte1 & 0x07 ) << 18 | ( Byte2 & 0x3F ) << 12 |
-                    ( Byte3 & 0x3F ) << 6 | Byte4 & 0x3F;
-        if ( codePoint < 0x10000 || codePoint > 0x10FFFF )
-        {
-          return {};
-        }
-
-        i += 4;
-      }
-      else
-      {
-        return {};
-      }
-
-      result.push_back( static_cast<c32>( codePoint ) );
-    }
-
+    AppendUtf32( str, result );
     return result;
   }
 
@@ -412,199 +251,99 @@ namespace Engine::Utility::String
 
   std::u32string ToUtf32( const std::u16string_view utf16Str )
   {
-    if ( utf16Str.empty() )
-    {
-      return {};
-    }
-
     std::u32string result;
-    result.reserve( utf16Str.length() );
-
-    for ( size i = 0; i < utf16Str.length(); /**/ )
-    {
-      if ( const auto Unit1 = utf16Str[ i ]; Unit1 < 0xD800 || Unit1 > 0xDFFF )
-      {
-        result.push_back( Unit1 );
-        i += 1;
-      }
-      else if ( Unit1 >= 0xD800 && Unit1 <= 0xDBFF )
-      {
-        if ( i + 1 >= utf16Str.length() )
-        {
-          return {};
-        }
-
-        const auto Unit2 = utf16Str[ i + 1 ];
-        if ( Unit2 < 0xDC00 || Unit2 > 0xDFFF )
-        {
-          return {};
-        }
-
-        const auto CodePoint =
-          0x10000 + ( ( Unit1 & 0x3FF ) << 10 ) + ( Unit2 & 0x3FF );
-        result.push_back( static_cast<c32>( CodePoint ) );
-
-        i += 2;
-      }
-      else
-      {
-        return {};
-      }
-    }
-
+    AppendUtf32( utf16Str, result );
     return result;
   }
 
-  bool IsUtf8( const std::string_view str )
+  TranscodeResult ToUtf8( const std::u16string_view utf16Str,
+                          const std::span<c8> out )
   {
-    for ( size i = 0; i < str.length(); /**/ )
-    {
-      if ( const auto Byte1 = static_cast<u8>( str[ i ] ); Byte1 < 0x80 )
-      {
-        i += 1;
-      }
-      else if ( Byte1 >> 5 == 0b110 )
-      {
-        if ( i + 1 >= str.length() )
-        {
-          return false;
-        }
-
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 )
-        {
-          return false;
-        }
+    return TranscodeInto( Utf16ToUtf8(), utf16Str, out );
+  }
 
-        if ( const auto CodePoint = ( Byte1 & 0x1F ) << 6 | Byte2 & 0x3F;
-             CodePoint < 0x80 )
-        {
-          return false;
-        }
+  TranscodeResult ToUtf8( const std::u32string_view utf32Str,
+                          const std::span<c8> out )
+  {
+    return TranscodeInto( Utf32ToUtf8(), utf32Str, out );
+  }
 
-        i += 2;
-      }
-      else if ( Byte1 >> 4 == 0b1110 )
-      {
-        if ( i + 2 >= str.length() )
-        {
-          return false;
-        }
+  TranscodeResult ToUtf16( const std::string_view str, const std::span<c16> out )
+  {
+    return TranscodeInto( Utf8ToUtf16(), str, out );
+  }
 
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 )
-        {
-          return false;
-        }
+  TranscodeResult ToUtf16( const std::u32string_view utf32Str,
+                           const std::span<c16> out )
+  {
+    return TranscodeInto( Utf32ToUtf16(), utf32Str, out );
+  }
 
-        const auto CodePoint =
-          ( Byte1 & 0x0F ) << 12 | ( Byte2 & 0x3F ) << 6 | Byte3 & 0x3F;
-        if ( CodePoint < 0x800 || ( CodePoint >= 0xD800 && CodePoint <= 0xDFFF ) )
-        {
-          return false;
-        }
+  TranscodeResult ToUtf32( const std::string_view str, const std::span<c32> out )
+  {
+    return TranscodeInto( Utf8ToUtf32(), str, out );
+  }
 
-        i += 3;
-      }
-      else if ( Byte1 >> 3 == 0b11110 )
-      {
-        if ( i + 3 >= str.length() )
-        {
-          return false;
-        }
+  TranscodeResult ToUtf32( const std::u16string_view utf16Str,
+                           const std::span<c32> out )
+  {
+    return TranscodeInto( Utf16ToUtf32(), utf16Str, out );
+  }
 
-        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
-        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
-        const auto Byte4 = static_cast<u8>( str[ i + 3 ] );
-        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 ||
-             ( Byte4 & 0xC0 ) != 0x80 )
-        {
-          return false;
-        }
+  TranscodeResult AppendUtf8( const std::u16string_view utf16Str, std::string & str )
+  {
+    return AppendTo( Utf16ToUtf8(), utf16Str, str );
+  }
 
-        const auto CodePoint = ( Byte1 & 0x07 ) << 18 | ( Byte2 & 0x3F ) << 12 |
-                               ( Byte3 & 0x3F ) << 6 | Byte4 & 0x3F;
-        if ( CodePoint < 0x10000 || CodePoint > 0x10FFFF )
-        {
-          return false;
-        }
+  TranscodeResult AppendUtf8( const std::u32string_view utf32Str, std::string & str )
+  {
+    return AppendTo( Utf32ToUtf8(), utf32Str, str );
+  }
 
-        i += 4;
-      }
-      else
-      {
-        return false;
-      }
-    }
+  TranscodeResult AppendUtf16( const std::string_view str,
+                               std::u16string & utf16Str )
+  {
+    return AppendTo( Utf8ToUtf16(), str, utf16Str );
+  }
 
-    return true;
+  TranscodeResult AppendUtf16( const std::u32string_view utf32Str,
+                               std::u16string & utf16Str )
+  {
+    return AppendTo( Utf32ToUtf16(), utf32Str, utf16Str );
   }
 
-  bool IsUtf16( const std::u16string_view utf16Str )
+  TranscodeResult AppendUtf32( const std::string_view str,
+                               std::u32string & utf32Str )
   {
-    for ( size i = 0; i < utf16Str.length(); /**/ )
-    {
-      if ( const auto Unit1 = utf16Str[ i ]; Unit1 < 0xD800 || Unit1 > 0xDFFF )
-      {
-        i += 1;
-      }
-      else if ( Unit1 >= 0xD800 && Unit1 <= 0xDBFF )
-      {
-        if ( i + 1 >= utf16Str.length() )
-        {
-          return false;
-        }
+    return AppendTo( Utf8ToUtf32(), str, utf32Str );
+  }
 
-        if ( const auto Unit2 = utf16Str[ i + 1 ]; Unit2 < 0xDC00 || Unit2 > 0xDFFF )
-        {
-          return false;
-        }
+  TranscodeResult AppendUtf32( const std::u16string_view utf16Str,
+                               std::u32string & utf32Str )
+  {
+    return AppendTo( Utf16ToUtf32(), utf16Str, utf32Str );
+  }
 
-        i += 2;
-      }
-      else
-      {
-        return false;
-      }
-    }
+  bool IsUtf8( const std::string_view str )
+  {
+    return Unicode::GetUnicodeKernels().m_pIsUtf8( str );
+  }
 
-    return true;
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    return Unicode::GetUnicodeKernels().m_pIsUtf16( utf16Str );
   }
 
   bool IsUtf32( const std::u32string_view utf32Str )
   {
-    for ( const auto CodePoint : utf32Str )
-    {
-      if ( CodePoint > 0x10FFFF || ( CodePoint >= 0xD800 && CodePoint <= 0xDFFF ) )
-      {
-        return false;
-      }
-    }
-
-    return true;
+    return Unicode::GetUnicodeKernels().m_pIsUtf32( utf32Str );
   }
 
 #if defined( _WIN32 )
   std::string ToUtf8( const std::wstring_view wideStr )
   {
-    if ( wideStr.empty() )
-    {
-      return {};
-    }
-
-    const auto Length = WideCharToMultiByte( CP_UTF8, 0, wideStr.data(),
-                                             static_cast<i32>( wideStr.length() ),
-                                             nullptr, 0, nullptr, nullptr );
-    if ( Length == 0 )
-    {
-      return {};
-    }
-
-    std::string result( Length, 0 );
-    WideCharToMultiByte( CP_UTF8, 0, wideStr.data(),
-                         static_cast<i32>( wideStr.length() ), result.data(), Length,
-                         nullptr, nullptr );
+    std::string result;
+    ToUtf8( wideStr, result );
     return result;
   }
 
@@ -620,21 +359,8 @@ namespace Engine::Utility::String
 
   std::wstring ToWide( const std::string_view str )
   {
-    if ( str.empty() )
-    {
-      return {};
-    }
-
-    const auto Length = MultiByteToWideChar(
-      CP_UTF8, 0, str.data(), static_cast<i32>( str.length() ), nullptr, 0 );
-    if ( Length == 0 )
-    {
-      return {};
-    }
-
-    std::wstring result( Length, 0 );
-    MultiByteToWideChar( CP_UTF8, 0, str.data(), static_cast<i32>( str.length() ),
-                         result.data(), Length );
+    std::wstring result;
+    ToWide( str, result );
     return result;
   }
 
@@ -650,32 +376,80 @@ namespace Engine::Utility::String
 
   void ToUtf8( const std::wstring_view wideStr, std::string & str )
   {
-    str = ToUtf8( wideStr );
+    str.clear();
+
+    // Only malformed input needs the system converter, which substitutes
+    // U+FFFD instead of failing.
+    const std::u16string_view Utf16( reinterpret_cast<const c16 *>( wideStr.data() ),
+                                     wideStr.length() );
+    if ( AppendUtf8( Utf16, str ).IsOk() )
+    {
+      return;
+    }
+
+    const auto Length = WideCharToMultiByte( CP_UTF8, 0, wideStr.data(),
+                                             static_cast<i32>( wideStr.length() ),
+                                             nullptr, 0, nullptr, nullptr );
+    if ( Length == 0 )
+    {
+      return;
+    }
+
+    str.resize( Length );
+    WideCharToMultiByte( CP_UTF8, 0, wideStr.data(),
+                         static_cast<i32>( wideStr.length() ), str.data(), Length,
+                         nullptr, nullptr );
   }
 
   void ToUtf8( const std::u16string_view utf16Str, std::string & str )
   {
-    str = ToUtf8( utf16Str );
+    str.clear();
+    AppendUtf8( utf16Str, str );
   }
 
   void ToUtf8( const std::u32string_view utf32Str, std::string & str )
   {
-    str = ToUtf8( utf32Str );
+    str.clear();
+    AppendUtf8( utf32Str, str );
   }
 
   void ToUtf16( const std::string_view str, std::u16string & utf16Str )
   {
-    utf16Str = ToUtf16( str );
+    utf16Str.clear();
+    AppendUtf16( str, utf16Str );
   }
 
   void ToUtf32( const std::string_view str, std::u32string & utf32Str )
   {
-    utf32Str = ToUtf32( str );
+    utf32Str.clear();
+    AppendUtf32( str, utf32Str );
   }
 
   void ToWide( const std::string_view str, std::wstring & wideStr )
   {
-    wideStr = ToWide( str );
+    wideStr.clear();
+
+    // wchar_t is UTF-16 here, so the kernels write straight into the wide
+    // string; as above, malformed input is left to the system converter.
+    if ( const auto & Kernels = Unicode::GetUnicodeKernels();
+         Kernels.m_pIsUtf8( str ) )
+    {
+      wideStr.resize( Kernels.m_pUtf16LengthFromUtf8( str ) );
+      Kernels.m_pConvertUtf8ToUtf16( str,
+                                     reinterpret_cast<c16 *>( wideStr.data() ) );
+      return;
+    }
+
+    const auto Length = MultiByteToWideChar(
+      CP_UTF8, 0, str.data(), static_cast<i32>( str.length() ), nullptr, 0 );
+    if ( Length == 0 )
+    {
+      return;
+    }
+
+    wideStr.resize( Length );
+    MultiByteToWideChar( CP_UTF8, 0, str.data(), static_cast<i32>( str.length() ),
+                         wideStr.data(), Length );
   }
 
   bool IsWide( const std::wstring_view wideStr )
@@ -705,37 +479,37 @@ namespace Engine::Utility::String
   }
 #endif
 
-  std::string Trim( const std::string_view str )
+  std::string_view TrimView( const std::string_view str )
   {
-    const auto Start = str.find_first_not_of( " \t\n\r\f\v" );
-    if ( Start == std::string_view::npos )
-    {
-      return {};
-    }
+    return TrimRightView( TrimLeftView( str ) );
+  }
 
-    const auto End = str.find_last_not_of( " \t\n\r\f\v" );
-    return std::string { str.substr( Start, End - Start + 1 ) };
+  std::string_view TrimLeftView( const std::string_view str )
+  {
+    const auto Start = FindFirstNotOf( str, s_Whitespace );
+    return Start == std::string_view::npos ? std::string_view {}
+                                           : str.substr( Start );
   }
 
-  std::string TrimLeft( const std::string_view str )
+  std::string_view TrimRightView( const std::string_view str )
   {
-    const auto Start = str.find_first_not_of( " \t\n\r\f\v" );
-    if ( Start == std::string_view::npos )
-    {
-      return {};
-    }
+    const auto End = FindLastNotOf( str, s_Whitespace );
+    return End == std::string_view::npos ? std::string_view {}
+                                         : str.substr( 0, End + 1 );
+  }
 
-    return std::string { str.substr( Start ) };
+  std::string Trim( const std::string_view str )
+  {
+    return std::string { TrimView( str ) };
   }
 
-  std::string TrimRight( const std::string_view str )
+  std::string TrimLeft( const std::string_view str )
   {
-    const auto End = str.find_last_not_of( " \t\n\r\f\v" );
-    if ( End == std::string_view::npos )
-    {
-      return {};
-    }
+    return std::string { TrimLeftView( str ) };
+  }
 
-    return std::string { str.substr( 0, End + 1 ) };
+  std::string TrimRight( const std::string_view str )
+  {
+    return std::string { TrimRightView( str ) };
   }
 } // namespace Engine::Utility::String
@@ -0,0 +1,199 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Engine/Core/Macro.hpp"
+#include "Engine/Utility/Logger.hpp"
+
+#include "Engine/Utility/StringId.hpp"
+
+namespace Engine::Utility
+{
+  // Open-addressed table of interned strings.  Readers probe without locking;
+  // writers serialize on a mutex and publish each entry with a release store.
+  // Growing swaps in a larger slot array and keeps the old one alive, since a
+  // reader may still be probing it.
+  class StringIdTable
+  {
+    DISALLOW_COPY( StringIdTable );
+    DISALLOW_MOVE( StringIdTable );
+
+  public:
+    StringIdTable()  = default;
+    ~StringIdTable() = default;
+
+    struct Entry
+    {
+      u64              m_Hash = 0;
+      std::string_view m_Text = {};
+    };
+
+    [[nodiscard]] const Entry * Find( const u64 hash ) const
+    {
+      const auto * pSlots = m_pSlots.load( std::memory_order_acquire );
+      if ( pSlots == nullptr )
+      {
+        return nullptr;
+      }
+
+      for ( auto i = hash & pSlots->m_Mask;; i = ( i + 1 ) & pSlots->m_Mask )
+      {
+        const auto * pEntry =
+          pSlots->m_pEntries[ i ].load( std::memory_order_acquire );
+        if ( pEntry == nullptr || pEntry->m_Hash == hash )
+        {
+          return pEntry;
+        }
+      }
+    }
+
+    const Entry * Insert( const u64 hash, const std::string_view str )
+    {
+      const std::scoped_lock Lock( m_Mutex );
+
+      if ( const auto * pEntry = Find( hash ) )
+      {
+        return pEntry;
+      }
+
+      if ( ( m_Count + 1 ) * 2 > m_Capacity )
+      {
+        Grow();
+      }
+
+      auto * pEntry = new ( Allocate( sizeof( Entry ), alignof( Entry ) ) ) Entry {};
+      auto * pText  = static_cast<c8 *>( Allocate( str.length(), 1 ) );
+      std::memcpy( pText, str.data(), str.length() );
+
+      pEntry->m_Hash = hash;
+      pEntry->m_Text = { pText, str.length() };
+
+      Publish( *m_SlotArrays.back(), pEntry );
+      ++m_Count;
+      return pEntry;
+    }
+
+  private:
+    static constexpr size s_InitialCapacity = 1024;
+    static constexpr size s_BlockSize       = 64 * 1024;
+
+    struct Slots
+    {
+      explicit Slots( const size capacity )
+        : m_Mask( capacity - 1 )
+        , m_pEntries( std::make_unique<std::atomic<const Entry *>[]>( capacity ) )
+      {
+      }
+
+      size                                          m_Mask;
+      std::unique_ptr<std::atomic<const Entry *>[]> m_pEntries;
+    };
+
+    static void Publish( Slots & slots, const Entry * pEntry )
+    {
+      auto i = pEntry->m_Hash & slots.m_Mask;
+      while ( slots.m_pEntries[ i ].load( std::memory_order_relaxed ) != nullptr )
+      {
+        i = ( i + 1 ) & slots.m_Mask;
+      }
+
+      slots.m_pEntries[ i ].store( pEntry, std::memory_order_release );
+    }
+
+    void Grow()
+    {
+      m_Capacity = m_Capacity == 0 ? s_InitialCapacity : m_Capacity * 2;
+
+      auto pSlots = std::make_unique<Slots>( m_Capacity );
+      if ( !m_SlotArrays.empty() )
+      {
+        const auto & Old = *m_SlotArrays.back();
+        for ( size i = 0; i <= Old.m_Mask; ++i )
+        {
+          const auto * pEntry =
+            Old.m_pEntries[ i ].load( std::memory_order_relaxed );
+          if ( pEntry != nullptr )
+          {
+            Publish( *pSlots, pEntry );
+          }
+        }
+      }
+
+      m_pSlots.store( pSlots.get(), std::memory_order_release );
+      m_SlotArrays.push_back( std::move( pSlots ) );
+    }
+
+    // Bump allocation from blocks that live as long as the table, so interned
+    // text never moves.
+    void * Allocate( const size bytes, const size alignment )
+    {
+      auto offset = ( m_BlockOffset + alignment - 1 ) & ~( alignment - 1 );
+      if ( m_Blocks.empty() || offset + bytes > s_BlockSize )
+      {
+        m_Blocks.push_back(
+          std::make_unique_for_overwrite<c8[]>( std::max( bytes, s_BlockSize ) ) );
+        offset = 0;
+      }
+
+      m_BlockOffset = offset + bytes;
+      return m_Blocks.back().get() + offset;
+    }
+
+    std::atomic<const Slots *> m_pSlots = nullptr;
+
+    // The last element is the live slot array; the rest are kept for readers.
+    std::vector<std::unique_ptr<Slots>> m_SlotArrays;
+    std::vector<std::unique_ptr<c8[]>>  m_Blocks;
+    size                                m_BlockOffset = 0;
+    size                                m_Capacity    = 0;
+    size                                m_Count       = 0;
+    std::mutex                          m_Mutex;
+  };
+
+  static StringIdTable & GetStringIdTable()
+  {
+    static StringIdTable s_Table;
+    return s_Table;
+  }
+
+  StringId StringId::Intern( const std::string_view str )
+  {
+    const StringId Id( str );
+
+    auto &       table  = GetStringIdTable();
+    const auto * pEntry = table.Find( Id.m_Hash );
+    if ( pEntry == nullptr )
+    {
+      pEntry = table.Insert( Id.m_Hash, str );
+    }
+
+    if ( pEntry->m_Text != str )
+    {
+      LOG_ERROR( "StringId collision: '{}' and '{}' both hash to {:016X}",
+                 pEntry->m_Text, str, Id.m_Hash );
+    }
+
+    return Id;
+  }
+
+  std::string_view StringId::GetString() const
+  {
+    const auto * pEntry = GetStringIdTable().Find( m_Hash );
+    return pEntry ? pEntry->m_Text : std::string_view {};
+  }
+} // namespace Engine::Utility
@@ -0,0 +1,219 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include "Engine/Core/Macro.hpp"
+
+#if defined( TRIUMPH_ARCH_X64 )
+#include <emmintrin.h>
+#elif defined( TRIUMPH_ARCH_ARM64 )
+#include <arm_neon.h>
+#endif
+
+#include <array>
+#include <bit>
+
+#include "Engine/Utility/String.hpp"
+
+namespace Engine::Utility::String
+{
+  // Sets up to this size are matched with one compare per member and block; larger
+  // sets fall back to a byte table.
+  static constexpr size s_MaxVectorSet = 8;
+
+#if defined( TRIUMPH_ARCH_X64 )
+  // SSE2 is part of x64, so these need no runtime dispatch.
+  using Block = __m128i;
+
+  static constexpr size s_BlockSize       = 16;
+  static constexpr u32  s_MaskBitsPerByte = 1;
+  static constexpr u64  s_FullMask        = 0xFFFF;
+
+  static Block Splat( const c8 value )
+  {
+    return _mm_set1_epi8( value );
+  }
+
+  // One bit per byte that equals any of the splatted set members.
+  static u64 MatchBlock( const c8 * pData, const Block * pSet, const size setLength )
+  {
+    const auto Input = _mm_loadu_si128( reinterpret_cast<const __m128i *>( pData ) );
+
+    auto matches = _mm_cmpeq_epi8( Input, pSet[ 0 ] );
+    for ( size i = 1; i < setLength; ++i )
+    {
+      matches = _mm_or_si128( matches, _mm_cmpeq_epi8( Input, pSet[ i ] ) );
+    }
+
+    return static_cast<u32>( _mm_movemask_epi8( matches ) );
+  }
+#elif defined( TRIUMPH_ARCH_ARM64 )
+  using Block = uint8x16_t;
+
+  static constexpr size s_BlockSize       = 16;
+  static constexpr u32  s_MaskBitsPerByte = 4;
+  static constexpr u64  s_FullMask        = ~0ull;
+
+  static Block Splat( const c8 value )
+  {
+    return vdupq_n_u8( static_cast<u8>( value ) );
+  }
+
+  // Four bits per byte that equals any of the splatted set members; narrowing
+  // with a shift is cheaper than emulating movemask.
+  static u64 MatchBlock( const c8 * pData, const Block * pSet, const size setLength )
+  {
+    const auto Input = vld1q_u8( reinterpret_cast<const u8 *>( pData ) );
+
+    auto matches = vceqq_u8( Input, pSet[ 0 ] );
+    for ( size i = 1; i < setLength; ++i )
+    {
+      matches = vorrq_u8( matches, vceqq_u8( Input, pSet[ i ] ) );
+    }
+
+    const auto Narrowed = vshrn_n_u16( vreinterpretq_u16_u8( matches ), 4 );
+    return vget_lane_u64( vreinterpret_u64_u8( Narrowed ), 0 );
+  }
+#endif
+
+  // Scalar membership for the remainder and for sets too large to splat.
+  class ByteSet
+  {
+  public:
+    explicit ByteSet( const std::string_view set )
+      : m_Set( set )
+    {
+      if ( set.length() > s_MaxVectorSet )
+      {
+        m_Table.fill( false );
+        for ( const auto Char : set )
+        {
+          m_Table[ static_cast<u8>( Char ) ] = true;
+        }
+      }
+    }
+
+    [[nodiscard]] bool Contains( const c8 value ) const
+    {
+      return m_Set.length() > s_MaxVectorSet ? m_Table[ static_cast<u8>( value ) ]
+                                             : m_Set.find( value ) != m_Set.npos;
+    }
+
+  private:
+    std::string_view m_Set;
+
+    // Only filled for large sets, so small ones skip clearing it.
+    std::array<bool, 256> m_Table;
+  };
+
+  template <bool IsMember>
+  static size FindFirst( const std::string_view str, const std::string_view set )
+  {
+    size i = 0;
+
+#if defined( TRIUMPH_ARCH_X64 ) || defined( TRIUMPH_ARCH_ARM64 )
+    if ( !set.empty() && set.length() <= s_MaxVectorSet &&
+         str.length() >= s_BlockSize )
+    {
+      Block splats[ s_MaxVectorSet ];
+      for ( size j = 0; j < set.length(); ++j )
+      {
+        splats[ j ] = Splat( set[ j ] );
+      }
+
+      for ( ; i + s_BlockSize <= str.length(); i += s_BlockSize )
+      {
+        auto mask = MatchBlock( str.data() + i, splats, set.length() );
+        if constexpr ( !IsMember )
+        {
+          mask ^= s_FullMask;
+        }
+
+        if ( mask != 0 )
+        {
+          return i + std::countr_zero( mask ) / s_MaskBitsPerByte;
+        }
+      }
+    }
+#endif
+
+    const ByteSet Set( set );
+    for ( ; i < str.length(); ++i )
+    {
+      if ( Set.Contains( str[ i ] ) == IsMember )
+      {
+        return i;
+      }
+    }
+
+    return std::string_view::npos;
+  }
+
+  size FindFirstOf( const std::string_view str, const std::string_view set )
+  {
+    if ( set.empty() )
+    {
+      return std::string_view::npos;
+    }
+
+    // memchr is already vectorized by the C library.
+    if ( set.length() == 1 )
+    {
+      return str.find( set[ 0 ] );
+    }
+
+    return FindFirst<true>( str, set );
+  }
+
+  size FindFirstNotOf( const std::string_view str, const std::string_view set )
+  {
+    return FindFirst<false>( str, set );
+  }
+
+  size FindLastNotOf( const std::string_view str, const std::string_view set )
+  {
+    auto i = str.length();
+
+#if defined( TRIUMPH_ARCH_X64 ) || defined( TRIUMPH_ARCH_ARM64 )
+    if ( !set.empty() && set.length() <= s_MaxVectorSet && i >= s_BlockSize )
+    {
+      Block splats[ s_MaxVectorSet ];
+      for ( size j = 0; j < set.length(); ++j )
+      {
+        splats[ j ] = Splat( set[ j ] );
+      }
+
+      for ( ; i >= s_BlockSize; i -= s_BlockSize )
+      {
+        const auto Mask =
+          MatchBlock( str.data() + i - s_BlockSize, splats, set.length() ) ^
+          s_FullMask;
+        if ( Mask != 0 )
+        {
+          const auto Last = ( std::bit_width( Mask ) - 1 ) / s_MaskBitsPerByte;
+          return i - s_BlockSize + Last;
+        }
+      }
+    }
+#endif
+
+    const ByteSet Set( set );
+    while ( i > 0 )
+    {
+      if ( !Set.Contains( str[ --i ] ) )
+      {
+        return i;
+      }
+    }
+
+    return std::string_view::npos;
+  }
+} // namespace Engine::Utility::String
@@ -0,0 +1,622 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include "Engine/Core/Macro.hpp"
+
+#if defined( TRIUMPH_ARCH_X64 )
+#include <immintrin.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "Engine/Utility/Unicode/CodePoint.hpp"
+#include "Engine/Utility/Unicode/Utf8Lookup.hpp"
+#endif
+
+#include "Engine/Utility/Unicode/UnicodeKernels.hpp"
+
+namespace Engine::Utility::Unicode::Avx2
+{
+#if defined( TRIUMPH_ARCH_X64 )
+  struct Utf8State
+  {
+    __m256i m_Error;
+    __m256i m_PrevInput;
+    __m256i m_PrevIncomplete;
+  };
+
+  TARGET_ISA( "avx2" )
+  static __m256i Load( const void * pData )
+  {
+    return _mm256_loadu_si256( static_cast<const __m256i *>( pData ) );
+  }
+
+  // Both 128-bit lanes hold the same table; vpshufb looks up within a lane.
+  TARGET_ISA( "avx2" )
+  static __m256i LoadTable( const std::array<u8, 16> & table )
+  {
+    return _mm256_broadcastsi128_si256(
+      _mm_loadu_si128( reinterpret_cast<const __m128i *>( table.data() ) ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  static __m256i HighNibbles( const __m256i input )
+  {
+    const auto Shifted = _mm256_srli_epi16( input, 4 );
+    return _mm256_and_si256( Shifted, _mm256_set1_epi8( 0x0F ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  static __m256i CheckUtf8Chunk( const __m256i input, const __m256i prevInput )
+  {
+    using namespace Utf8Lookup;
+
+    // alignr works per lane, so shift in the upper lane of the previous chunk.
+    const auto Carried = _mm256_permute2x128_si256( prevInput, input, 0x21 );
+    const auto Prev1   = _mm256_alignr_epi8( input, Carried, 16 - 1 );
+    const auto Prev2   = _mm256_alignr_epi8( input, Carried, 16 - 2 );
+    const auto Prev3   = _mm256_alignr_epi8( input, Carried, 16 - 3 );
+
+    const auto Byte1High =
+      _mm256_shuffle_epi8( LoadTable( s_Byte1High ), HighNibbles( Prev1 ) );
+    const auto Byte1Low = _mm256_shuffle_epi8(
+      LoadTable( s_Byte1Low ), _mm256_and_si256( Prev1, _mm256_set1_epi8( 0x0F ) ) );
+    const auto Byte2High =
+      _mm256_shuffle_epi8( LoadTable( s_Byte2High ), HighNibbles( input ) );
+    const auto Special =
+      _mm256_and_si256( _mm256_and_si256( Byte1High, Byte1Low ), Byte2High );
+
+    const auto IsThird  = _mm256_subs_epu8( Prev2, _mm256_set1_epi8( 0xE0 - 0x80 ) );
+    const auto IsFourth = _mm256_subs_epu8( Prev3, _mm256_set1_epi8( 0xF0 - 0x80 ) );
+    const auto Must23   = _mm256_and_si256( _mm256_or_si256( IsThird, IsFourth ),
+                                            _mm256_set1_epi8( -0x80 ) );
+    return _mm256_xor_si256( Must23, Special );
+  }
+
+  TARGET_ISA( "avx2" )
+  static void CheckUtf8Block( const u8 * pBlock, Utf8State & state )
+  {
+    const auto Input0 = Load( pBlock );
+    const auto Input1 = Load( pBlock + 32 );
+
+    if ( _mm256_movemask_epi8( _mm256_or_si256( Input0, Input1 ) ) == 0 )
+    {
+      state.m_Error     = _mm256_or_si256( state.m_Error, state.m_PrevIncomplete );
+      state.m_PrevInput = Input1;
+      state.m_PrevIncomplete = _mm256_setzero_si256();
+      return;
+    }
+
+    const auto Error = _mm256_or_si256( CheckUtf8Chunk( Input0, state.m_PrevInput ),
+                                        CheckUtf8Chunk( Input1, Input0 ) );
+
+    state.m_Error     = _mm256_or_si256( state.m_Error, Error );
+    state.m_PrevInput = Input1;
+    state.m_PrevIncomplete =
+      _mm256_subs_epu8( Input1, Load( Utf8Lookup::s_IncompleteMax.data() ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  bool IsUtf8( const std::string_view str )
+  {
+    const auto * pData = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+
+    Utf8State state { _mm256_setzero_si256(), _mm256_setzero_si256(),
+                      _mm256_setzero_si256() };
+
+    size i = 0;
+    for ( ; i + 64 <= Length; i += 64 )
+    {
+      CheckUtf8Block( pData + i, state );
+    }
+
+    if ( i < Length )
+    {
+      u8 tail[ 64 ] = {};
+      std::memcpy( tail, pData + i, Length - i );
+      CheckUtf8Block( tail, state );
+    }
+
+    const auto Error = _mm256_or_si256( state.m_Error, state.m_PrevIncomplete );
+    return _mm256_testz_si256( Error, Error ) != 0;
+  }
+
+  template <bool CountPairs>
+  TARGET_ISA( "avx2" )
+  static size CountUtf8( const std::string_view str )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+
+    auto total = _mm256_setzero_si256();
+    size i     = 0;
+    while ( i + 32 <= Length )
+    {
+      const auto End    = std::min( Length - 31, i + 127 * 32 );
+      auto       counts = _mm256_setzero_si256();
+      for ( ; i < End; i += 32 )
+      {
+        const auto Input = Load( pData + i );
+        const auto Lead  = _mm256_cmpgt_epi8( Input, _mm256_set1_epi8( -65 ) );
+        counts           = _mm256_sub_epi8( counts, Lead );
+        if constexpr ( CountPairs )
+        {
+          const auto Four = _mm256_cmpeq_epi8(
+            _mm256_max_epu8( Input, _mm256_set1_epi8( -16 ) ), Input );
+          counts = _mm256_sub_epi8( counts, Four );
+        }
+      }
+
+      total =
+        _mm256_add_epi64( total, _mm256_sad_epu8( counts, _mm256_setzero_si256() ) );
+    }
+
+    const auto Half = _mm_add_epi64( _mm256_castsi256_si128( total ),
+                                     _mm256_extracti128_si256( total, 1 ) );
+    const auto Sum  = static_cast<size>( _mm_cvtsi128_si64( Half ) ) +
+                     static_cast<size>( _mm_extract_epi64( Half, 1 ) );
+    const auto Tail = str.substr( i );
+    return Sum + ( CountPairs ? Scalar::Utf16LengthFromUtf8( Tail )
+                              : Scalar::Utf32LengthFromUtf8( Tail ) );
+  }
+
+  template <typename Char>
+  TARGET_ISA( "avx2" )
+  static size ConvertUtf8( const std::string_view str, Char * pOut )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 32 <= Length )
+    {
+      const auto Input = Load( pData + i );
+      const auto Mask  = static_cast<u32>( _mm256_movemask_epi8( Input ) );
+      if ( Mask == 0 )
+      {
+        const auto Low  = _mm256_castsi256_si128( Input );
+        const auto High = _mm256_extracti128_si256( Input, 1 );
+        auto *     pDst = reinterpret_cast<__m256i *>( pWrite );
+        if constexpr ( sizeof( Char ) == 2 )
+        {
+          _mm256_storeu_si256( pDst, _mm256_cvtepu8_epi16( Low ) );
+          _mm256_storeu_si256( pDst + 1, _mm256_cvtepu8_epi16( High ) );
+        }
+        else
+        {
+          _mm256_storeu_si256( pDst, _mm256_cvtepu8_epi32( Low ) );
+          _mm256_storeu_si256( pDst + 1,
+                               _mm256_cvtepu8_epi32( _mm_srli_si128( Low, 8 ) ) );
+          _mm256_storeu_si256( pDst + 2, _mm256_cvtepu8_epi32( High ) );
+          _mm256_storeu_si256( pDst + 3,
+                               _mm256_cvtepu8_epi32( _mm_srli_si128( High, 8 ) ) );
+        }
+
+        i      += 32;
+        pWrite += 32;
+        continue;
+      }
+
+      // Copy the ASCII run up to the first sequence, then decode until the
+      // next ASCII byte so the following load starts on fresh data.
+      for ( auto run = std::countr_zero( Mask ); run > 0; --run )
+      {
+        *pWrite++ = pData[ i++ ];
+      }
+
+      do
+      {
+        u32 codePoint  = 0;
+        i             += DecodeValidUtf8( pData + i, codePoint );
+        if constexpr ( sizeof( Char ) == 2 )
+        {
+          pWrite += EncodeUtf16( codePoint, pWrite );
+        }
+        else
+        {
+          *pWrite++ = codePoint;
+        }
+      } while ( i < Length && pData[ i ] >= 0x80 );
+    }
+
+    const auto Tail = str.substr( i );
+    if constexpr ( sizeof( Char ) == 2 )
+    {
+      pWrite += Scalar::ConvertUtf8ToUtf16( Tail, pWrite );
+    }
+    else
+    {
+      pWrite += Scalar::ConvertUtf8ToUtf32( Tail, pWrite );
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  TARGET_ISA( "avx2" )
+  size Utf16LengthFromUtf8( const std::string_view str )
+  {
+    return CountUtf8<true>( str );
+  }
+
+  TARGET_ISA( "avx2" )
+  size Utf32LengthFromUtf8( const std::string_view str )
+  {
+    return CountUtf8<false>( str );
+  }
+
+  TARGET_ISA( "avx2" )
+  size ConvertUtf8ToUtf16( const std::string_view str, c16 * pOut )
+  {
+    return ConvertUtf8( str, pOut );
+  }
+
+  TARGET_ISA( "avx2" )
+  size ConvertUtf8ToUtf32( const std::string_view str, c32 * pOut )
+  {
+    return ConvertUtf8( str, pOut );
+  }
+
+  TARGET_ISA( "avx2" )
+  static __m256i Splat16( const u16 value )
+  {
+    return _mm256_set1_epi16( static_cast<i16>( value ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  static __m256i Splat32( const u32 value )
+  {
+    return _mm256_set1_epi32( static_cast<i32>( value ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  static __m256i IsAtLeast( const __m256i units, const u16 value )
+  {
+    return _mm256_cmpeq_epi16( _mm256_max_epu16( units, Splat16( value ) ), units );
+  }
+
+  TARGET_ISA( "avx2" )
+  static __m256i IsSurrogate( const __m256i units )
+  {
+    return _mm256_cmpeq_epi16( _mm256_and_si256( units, Splat16( 0xF800 ) ),
+                               Splat16( 0xD800 ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  static bool HasSurrogate( const __m256i units )
+  {
+    return _mm256_movemask_epi8( IsSurrogate( units ) ) != 0;
+  }
+
+  TARGET_ISA( "avx2" )
+  static bool HasBitsSet( const __m256i units, const u16 mask )
+  {
+    return _mm256_testz_si256( units, Splat16( mask ) ) == 0;
+  }
+
+  TARGET_ISA( "avx2" )
+  static u32 SumLanes32( const __m256i lanes )
+  {
+    auto sums = _mm_add_epi32( _mm256_castsi256_si128( lanes ),
+                               _mm256_extracti128_si256( lanes, 1 ) );
+    sums      = _mm_hadd_epi32( sums, sums );
+    sums      = _mm_hadd_epi32( sums, sums );
+    return static_cast<u32>( _mm_cvtsi128_si32( sums ) );
+  }
+
+  // Encodes eight units below U+0800 and stores 16 bytes, of which the
+  // returned count are used; the caller keeps enough output to spare.
+  TARGET_ISA( "avx2" )
+  static size PackTwoByte( const __m128i units, c8 * pOut )
+  {
+    const auto High  = _mm_srli_epi16( units, 6 );
+    const auto Lead  = _mm_or_si128( High, _mm_set1_epi16( 0xC0 ) );
+    const auto Low   = _mm_and_si128( units, _mm_set1_epi16( 0x3F ) );
+    const auto Cont  = _mm_or_si128( Low, _mm_set1_epi16( 0x80 ) );
+    const auto Pair  = _mm_or_si128( Lead, _mm_slli_epi16( Cont, 8 ) );
+    const auto IsTwo = _mm_cmpgt_epi16( units, _mm_set1_epi16( 0x7F ) );
+    const auto Words = _mm_blendv_epi8( units, Pair, IsTwo );
+
+    const auto Mask    = static_cast<u32>(
+      _mm_movemask_epi8( _mm_packs_epi16( IsTwo, _mm_setzero_si128() ) ) );
+    const auto Shuffle = _mm_loadu_si128( reinterpret_cast<const __m128i *>(
+      Utf8Lookup::s_PackTwoByte[ Mask ].data() ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i *>( pOut ),
+                      _mm_shuffle_epi8( Words, Shuffle ) );
+    return 8 + static_cast<size>( std::popcount( Mask ) );
+  }
+
+  // Both halves of a 16-unit chunk below U+0800.
+  TARGET_ISA( "avx2" )
+  static size PackTwoByte( const __m256i units, c8 * pOut )
+  {
+    const auto Written = PackTwoByte( _mm256_castsi256_si128( units ), pOut );
+    return Written +
+           PackTwoByte( _mm256_extracti128_si256( units, 1 ), pOut + Written );
+  }
+
+  // Narrows 32 units below U+0100 to bytes; packus works per lane, so the
+  // result is put back in order.
+  TARGET_ISA( "avx2" )
+  static __m256i NarrowToBytes( const __m256i units0, const __m256i units1 )
+  {
+    return _mm256_permute4x64_epi64( _mm256_packus_epi16( units0, units1 ), 0xD8 );
+  }
+
+  // Narrows 16 code points to 16-bit units in order, saturating at 0xFFFF.
+  TARGET_ISA( "avx2" )
+  static __m256i NarrowToUnits( const __m256i points0, const __m256i points1 )
+  {
+    return _mm256_permute4x64_epi64( _mm256_packus_epi32( points0, points1 ), 0xD8 );
+  }
+
+  TARGET_ISA( "avx2" )
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+
+    size i = 0;
+    while ( i + 16 <= Length )
+    {
+      if ( !HasSurrogate( Load( pData + i ) ) )
+      {
+        i += 16;
+        continue;
+      }
+
+      for ( const auto End = i + 16; i < End; /**/ )
+      {
+        if ( const auto Unit = pData[ i ]; Unit < 0xD800 || Unit > 0xDFFF )
+        {
+          i += 1;
+        }
+        else if ( Unit <= 0xDBFF && i + 1 < Length && pData[ i + 1 ] >= 0xDC00 &&
+                  pData[ i + 1 ] <= 0xDFFF )
+        {
+          i += 2;
+        }
+        else
+        {
+          return false;
+        }
+      }
+    }
+
+    return Scalar::IsUtf16( utf16Str.substr( i ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  bool IsUtf32( const std::u32string_view utf32Str )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+    const auto   Limit  = Splat32( 0x10FFFF );
+
+    auto max       = _mm256_setzero_si256();
+    auto surrogate = _mm256_setzero_si256();
+    size i         = 0;
+    for ( ; i + 8 <= Length; i += 8 )
+    {
+      const auto Units  = Load( pData + i );
+      const auto Masked = _mm256_and_si256( Units, Splat32( 0xFFFFF800 ) );
+      const auto Match  = _mm256_cmpeq_epi32( Masked, Splat32( 0xD800 ) );
+      max               = _mm256_max_epu32( max, Units );
+      surrogate         = _mm256_or_si256( surrogate, Match );
+    }
+
+    const auto InRange = _mm256_cmpeq_epi32( _mm256_max_epu32( max, Limit ), Limit );
+    return _mm256_movemask_epi8( InRange ) == -1 &&
+           _mm256_testz_si256( surrogate, surrogate ) &&
+           Scalar::IsUtf32( utf32Str.substr( i ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  size Utf8LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+
+    size extra = 0;
+    size i     = 0;
+    while ( i + 16 <= Length )
+    {
+      const auto End    = std::min( Length - 15, i + 8192 * 16 );
+      auto       counts = _mm256_setzero_si256();
+      for ( ; i < End; i += 16 )
+      {
+        const auto Units = Load( pData + i );
+        counts           = _mm256_sub_epi16( counts, IsAtLeast( Units, 0x80 ) );
+        counts           = _mm256_sub_epi16( counts, IsAtLeast( Units, 0x800 ) );
+        counts           = _mm256_add_epi16( counts, IsSurrogate( Units ) );
+      }
+
+      extra += SumLanes32( _mm256_madd_epi16( counts, Splat16( 1 ) ) );
+    }
+
+    return i + extra + Scalar::Utf8LengthFromUtf16( utf16Str.substr( i ) );
+  }
+
+  TARGET_ISA( "avx2" )
+  size Utf8LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+
+    size extra = 0;
+    size i     = 0;
+    while ( i + 8 <= Length )
+    {
+      const auto End    = std::min( Length - 7, i + 65536 * 8 );
+      auto       counts = _mm256_setzero_si256();
+      for ( ; i < End; i += 8 )
+      {
+        // Valid code points are positive, so the signed compares hold.
+        const auto Units = Load( pData + i );
+        for ( const u32 Bound : { 0x7Fu, 0x7FFu, 0xFFFFu } )
+        {
+          const auto Above = _mm256_cmpgt_epi32( Units, Splat32( Bound ) );
+          counts           = _mm256_sub_epi32( counts, Above );
+        }
+      }
+
+      extra += SumLanes32( counts );
+    }
+
+    return i + extra + Scalar::Utf8LengthFromUtf32( utf32Str.substr( i ) );
+  }
+
+  // The loops below stop 32 units short of the end: every unit left over
+  // needs at least one byte, so the wide stores stay inside the output.
+  TARGET_ISA( "avx2" )
+  size ConvertUtf16ToUtf8( const std::u16string_view utf16Str, c8 * pOut )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 32 <= Length )
+    {
+      const auto Units0 = Load( pData + i );
+      const auto Units1 = Load( pData + i + 16 );
+      if ( !HasBitsSet( _mm256_or_si256( Units0, Units1 ), 0xFF80 ) )
+      {
+        _mm256_storeu_si256( reinterpret_cast<__m256i *>( pWrite ),
+                             NarrowToBytes( Units0, Units1 ) );
+        i      += 32;
+        pWrite += 32;
+      }
+      else if ( !HasBitsSet( Units0, 0xF800 ) )
+      {
+        pWrite += PackTwoByte( Units0, pWrite );
+        i      += 16;
+      }
+      else if ( !HasSurrogate( Units0 ) )
+      {
+        for ( const auto End = i + 16; i < End; ++i )
+        {
+          pWrite += EncodeUtf8( pData[ i ], pWrite );
+        }
+      }
+      else
+      {
+        for ( const auto End = i + 16; i < End; /**/ )
+        {
+          u32 codePoint  = 0;
+          i             += DecodeValidUtf16( pData + i, codePoint );
+          pWrite        += EncodeUtf8( codePoint, pWrite );
+        }
+      }
+    }
+
+    pWrite += Scalar::ConvertUtf16ToUtf8( utf16Str.substr( i ), pWrite );
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  TARGET_ISA( "avx2" )
+  size ConvertUtf32ToUtf8( const std::u32string_view utf32Str, c8 * pOut )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 32 <= Length )
+    {
+      // Saturating to 16 bits keeps anything above U+FFFF off the fast paths.
+      const auto Units0 = NarrowToUnits( Load( pData + i ), Load( pData + i + 8 ) );
+      const auto Units1 =
+        NarrowToUnits( Load( pData + i + 16 ), Load( pData + i + 24 ) );
+      if ( !HasBitsSet( _mm256_or_si256( Units0, Units1 ), 0xFF80 ) )
+      {
+        _mm256_storeu_si256( reinterpret_cast<__m256i *>( pWrite ),
+                             NarrowToBytes( Units0, Units1 ) );
+        i      += 32;
+        pWrite += 32;
+      }
+      else if ( !HasBitsSet( Units0, 0xF800 ) )
+      {
+        pWrite += PackTwoByte( Units0, pWrite );
+        i      += 16;
+      }
+      else
+      {
+        for ( const auto End = i + 16; i < End; ++i )
+        {
+          pWrite += EncodeUtf8( pData[ i ], pWrite );
+        }
+      }
+    }
+
+    pWrite += Scalar::ConvertUtf32ToUtf8( utf32Str.substr( i ), pWrite );
+    return static_cast<size>( pWrite - pOut );
+  }
+#else
+  bool IsUtf8( const std::string_view str )
+  {
+    return Scalar::IsUtf8( str );
+  }
+
+  size Utf16LengthFromUtf8( const std::string_view str )
+  {
+    return Scalar::Utf16LengthFromUtf8( str );
+  }
+
+  size Utf32LengthFromUtf8( const std::string_view str )
+  {
+    return Scalar::Utf32LengthFromUtf8( str );
+  }
+
+  size ConvertUtf8ToUtf16( const std::string_view str, c16 * pOut )
+  {
+    return Scalar::ConvertUtf8ToUtf16( str, pOut );
+  }
+
+  size ConvertUtf8ToUtf32( const std::string_view str, c32 * pOut )
+  {
+    return Scalar::ConvertUtf8ToUtf32( str, pOut );
+  }
+
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    return Scalar::IsUtf16( utf16Str );
+  }
+
+  bool IsUtf32( const std::u32string_view utf32Str )
+  {
+    return Scalar::IsUtf32( utf32Str );
+  }
+
+  size Utf8LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    return Scalar::Utf8LengthFromUtf16( utf16Str );
+  }
+
+  size Utf8LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    return Scalar::Utf8LengthFromUtf32( utf32Str );
+  }
+
+  size ConvertUtf16ToUtf8( const std::u16string_view utf16Str, c8 * pOut )
+  {
+    return Scalar::ConvertUtf16ToUtf8( utf16Str, pOut );
+  }
+
+  size ConvertUtf32ToUtf8( const std::u32string_view utf32Str, c8 * pOut )
+  {
+    return Scalar::ConvertUtf32ToUtf8( utf32Str, pOut );
+  }
+#endif
+} // namespace Engine::Utility::Unicode::Avx2
@@ -0,0 +1,524 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include "Engine/Core/Macro.hpp"
+
+#if defined( TRIUMPH_ARCH_ARM64 )
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "Engine/Utility/Unicode/CodePoint.hpp"
+#include "Engine/Utility/Unicode/Utf8Lookup.hpp"
+#endif
+
+#include "Engine/Utility/Unicode/UnicodeKernels.hpp"
+
+namespace Engine::Utility::Unicode::Neon
+{
+#if defined( TRIUMPH_ARCH_ARM64 )
+  struct Utf8State
+  {
+    uint8x16_t m_Error;
+    uint8x16_t m_PrevInput;
+    uint8x16_t m_PrevIncomplete;
+  };
+
+  static uint8x16_t CheckUtf8Chunk( const uint8x16_t input,
+                                    const uint8x16_t prevInput )
+  {
+    using namespace Utf8Lookup;
+
+    const auto Prev1 = vextq_u8( prevInput, input, 16 - 1 );
+    const auto Prev2 = vextq_u8( prevInput, input, 16 - 2 );
+    const auto Prev3 = vextq_u8( prevInput, input, 16 - 3 );
+
+    // The u8 shift leaves only the high nibble, no mask needed.
+    const auto Byte1High =
+      vqtbl1q_u8( vld1q_u8( s_Byte1High.data() ), vshrq_n_u8( Prev1, 4 ) );
+    const auto Byte1Low  = vqtbl1q_u8( vld1q_u8( s_Byte1Low.data() ),
+                                       vandq_u8( Prev1, vdupq_n_u8( 0x0F ) ) );
+    const auto Byte2High =
+      vqtbl1q_u8( vld1q_u8( s_Byte2High.data() ), vshrq_n_u8( input, 4 ) );
+    const auto Special = vandq_u8( vandq_u8( Byte1High, Byte1Low ), Byte2High );
+
+    const auto IsThird  = vqsubq_u8( Prev2, vdupq_n_u8( 0xE0 - 0x80 ) );
+    const auto IsFourth = vqsubq_u8( Prev3, vdupq_n_u8( 0xF0 - 0x80 ) );
+    const auto Must23 =
+      vandq_u8( vorrq_u8( IsThird, IsFourth ), vdupq_n_u8( 0x80 ) );
+    return veorq_u8( Must23, Special );
+  }
+
+  static void CheckUtf8Block( const u8 * pBlock, Utf8State & state )
+  {
+    const auto Input0 = vld1q_u8( pBlock );
+    const auto Input1 = vld1q_u8( pBlock + 16 );
+    const auto Input2 = vld1q_u8( pBlock + 32 );
+    const auto Input3 = vld1q_u8( pBlock + 48 );
+
+    const auto Any =
+      vorrq_u8( vorrq_u8( Input0, Input1 ), vorrq_u8( Input2, Input3 ) );
+    if ( vmaxvq_u8( Any ) < 0x80 )
+    {
+      state.m_Error          = vorrq_u8( state.m_Error, state.m_PrevIncomplete );
+      state.m_PrevInput      = Input3;
+      state.m_PrevIncomplete = vdupq_n_u8( 0 );
+      return;
+    }
+
+    auto error = CheckUtf8Chunk( Input0, state.m_PrevInput );
+    error      = vorrq_u8( error, CheckUtf8Chunk( Input1, Input0 ) );
+    error      = vorrq_u8( error, CheckUtf8Chunk( Input2, Input1 ) );
+    error      = vorrq_u8( error, CheckUtf8Chunk( Input3, Input2 ) );
+
+    state.m_Error     = vorrq_u8( state.m_Error, error );
+    state.m_PrevInput = Input3;
+    state.m_PrevIncomplete =
+      vqsubq_u8( Input3, vld1q_u8( Utf8Lookup::s_IncompleteMax.data() + 16 ) );
+  }
+
+  bool IsUtf8( const std::string_view str )
+  {
+    const auto * pData = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+
+    Utf8State state { vdupq_n_u8( 0 ), vdupq_n_u8( 0 ), vdupq_n_u8( 0 ) };
+
+    size i = 0;
+    for ( ; i + 64 <= Length; i += 64 )
+    {
+      CheckUtf8Block( pData + i, state );
+    }
+
+    if ( i < Length )
+    {
+      u8 tail[ 64 ] = {};
+      std::memcpy( tail, pData + i, Length - i );
+      CheckUtf8Block( tail, state );
+    }
+
+    return vmaxvq_u8( vorrq_u8( state.m_Error, state.m_PrevIncomplete ) ) == 0;
+  }
+
+  template <bool CountPairs>
+  static size CountUtf8( const std::string_view str )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+
+    size sum = 0;
+    size i   = 0;
+    while ( i + 16 <= Length )
+    {
+      const auto End    = std::min( Length - 15, i + 127 * 16 );
+      auto       counts = vdupq_n_u8( 0 );
+      for ( ; i < End; i += 16 )
+      {
+        const auto Input = vld1q_u8( pData + i );
+        const auto Lead =
+          vcgtq_s8( vreinterpretq_s8_u8( Input ), vdupq_n_s8( -65 ) );
+        counts = vsubq_u8( counts, Lead );
+        if constexpr ( CountPairs )
+        {
+          counts = vsubq_u8( counts, vcgeq_u8( Input, vdupq_n_u8( 0xF0 ) ) );
+        }
+      }
+
+      sum += vaddlvq_u8( counts );
+    }
+
+    const auto Tail = str.substr( i );
+    return sum + ( CountPairs ? Scalar::Utf16LengthFromUtf8( Tail )
+                              : Scalar::Utf32LengthFromUtf8( Tail ) );
+  }
+
+  template <typename Char>
+  static size ConvertUtf8( const std::string_view str, Char * pOut )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 16 <= Length )
+    {
+      const auto Input = vld1q_u8( pData + i );
+      if ( vmaxvq_u8( Input ) < 0x80 )
+      {
+        const auto Low  = vmovl_u8( vget_low_u8( Input ) );
+        const auto High = vmovl_high_u8( Input );
+        if constexpr ( sizeof( Char ) == 2 )
+        {
+          auto * pDst = reinterpret_cast<u16 *>( pWrite );
+          vst1q_u16( pDst, Low );
+          vst1q_u16( pDst + 8, High );
+        }
+        else
+        {
+          auto * pDst = reinterpret_cast<u32 *>( pWrite );
+          vst1q_u32( pDst, vmovl_u16( vget_low_u16( Low ) ) );
+          vst1q_u32( pDst + 4, vmovl_high_u16( Low ) );
+          vst1q_u32( pDst + 8, vmovl_u16( vget_low_u16( High ) ) );
+          vst1q_u32( pDst + 12, vmovl_high_u16( High ) );
+        }
+
+        i      += 16;
+        pWrite += 16;
+        continue;
+      }
+
+      // The chunk holds a non-ASCII byte, so this run stops inside it.
+      while ( pData[ i ] < 0x80 )
+      {
+        *pWrite++ = pData[ i++ ];
+      }
+
+      do
+      {
+        u32 codePoint  = 0;
+        i             += DecodeValidUtf8( pData + i, codePoint );
+        if constexpr ( sizeof( Char ) == 2 )
+        {
+          pWrite += EncodeUtf16( codePoint, pWrite );
+        }
+        else
+        {
+          *pWrite++ = codePoint;
+        }
+      } while ( i < Length && pData[ i ] >= 0x80 );
+    }
+
+    const auto Tail = str.substr( i );
+    if constexpr ( sizeof( Char ) == 2 )
+    {
+      pWrite += Scalar::ConvertUtf8ToUtf16( Tail, pWrite );
+    }
+    else
+    {
+      pWrite += Scalar::ConvertUtf8ToUtf32( Tail, pWrite );
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  size Utf16LengthFromUtf8( const std::string_view str )
+  {
+    return CountUtf8<true>( str );
+  }
+
+  size Utf32LengthFromUtf8( const std::string_view str )
+  {
+    return CountUtf8<false>( str );
+  }
+
+  size ConvertUtf8ToUtf16( const std::string_view str, c16 * pOut )
+  {
+    return ConvertUtf8( str, pOut );
+  }
+
+  size ConvertUtf8ToUtf32( const std::string_view str, c32 * pOut )
+  {
+    return ConvertUtf8( str, pOut );
+  }
+
+  static uint16x8_t Load( const c16 * pData )
+  {
+    return vld1q_u16( reinterpret_cast<const u16 *>( pData ) );
+  }
+
+  static uint32x4_t Load( const c32 * pData )
+  {
+    return vld1q_u32( reinterpret_cast<const u32 *>( pData ) );
+  }
+
+  static uint16x8_t IsSurrogate( const uint16x8_t units )
+  {
+    return vceqq_u16( vandq_u16( units, vdupq_n_u16( 0xF800 ) ),
+                      vdupq_n_u16( 0xD800 ) );
+  }
+
+  // Encodes eight units below U+0800 and stores 16 bytes, of which the
+  // returned count are used; the caller keeps enough output to spare.
+  static size PackTwoByte( const uint16x8_t units, c8 * pOut )
+  {
+    static constexpr u16 s_LaneBits[ 8 ] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+
+    const auto Lead  = vorrq_u16( vshrq_n_u16( units, 6 ), vdupq_n_u16( 0xC0 ) );
+    const auto Low   = vandq_u16( units, vdupq_n_u16( 0x3F ) );
+    const auto Cont  = vorrq_u16( Low, vdupq_n_u16( 0x80 ) );
+    const auto Pair  = vorrq_u16( Lead, vshlq_n_u16( Cont, 8 ) );
+    const auto IsTwo = vcgtq_u16( units, vdupq_n_u16( 0x7F ) );
+    const auto Words = vbslq_u16( IsTwo, Pair, units );
+
+    const auto Bits    = vandq_u16( IsTwo, vld1q_u16( s_LaneBits ) );
+    const auto Mask    = static_cast<u32>( vaddvq_u16( Bits ) );
+    const auto Shuffle = vld1q_u8( Utf8Lookup::s_PackTwoByte[ Mask ].data() );
+    vst1q_u8( reinterpret_cast<u8 *>( pOut ),
+              vqtbl1q_u8( vreinterpretq_u8_u16( Words ), Shuffle ) );
+    return 8 + static_cast<size>( std::popcount( Mask ) );
+  }
+
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+
+    size i = 0;
+    while ( i + 8 <= Length )
+    {
+      if ( vmaxvq_u16( IsSurrogate( Load( pData + i ) ) ) == 0 )
+      {
+        i += 8;
+        continue;
+      }
+
+      // Check pairing a code point at a time; a pair may straddle chunks.
+      for ( const auto End = i + 8; i < End; /**/ )
+      {
+        if ( const auto Unit = pData[ i ]; Unit < 0xD800 || Unit > 0xDFFF )
+        {
+          i += 1;
+        }
+        else if ( Unit <= 0xDBFF && i + 1 < Length && pData[ i + 1 ] >= 0xDC00 &&
+                  pData[ i + 1 ] <= 0xDFFF )
+        {
+          i += 2;
+        }
+        else
+        {
+          return false;
+        }
+      }
+    }
+
+    return Scalar::IsUtf16( utf16Str.substr( i ) );
+  }
+
+  bool IsUtf32( const std::u32string_view utf32Str )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+
+    auto max       = vdupq_n_u32( 0 );
+    auto surrogate = vdupq_n_u32( 0 );
+    size i         = 0;
+    for ( ; i + 4 <= Length; i += 4 )
+    {
+      const auto Units  = Load( pData + i );
+      const auto Masked = vandq_u32( Units, vdupq_n_u32( 0xFFFFF800 ) );
+      const auto Match  = vceqq_u32( Masked, vdupq_n_u32( 0xD800 ) );
+      max               = vmaxq_u32( max, Units );
+      surrogate         = vorrq_u32( surrogate, Match );
+    }
+
+    return vmaxvq_u32( max ) <= 0x10FFFF && vmaxvq_u32( surrogate ) == 0 &&
+           Scalar::IsUtf32( utf32Str.substr( i ) );
+  }
+
+  size Utf8LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+
+    // Every unit is at least one byte; count the extra bytes in 16-bit lanes.
+    size extra = 0;
+    size i     = 0;
+    while ( i + 8 <= Length )
+    {
+      const auto End    = std::min( Length - 7, i + 8192 * 8 );
+      auto       counts = vdupq_n_u16( 0 );
+      for ( ; i < End; i += 8 )
+      {
+        // A surrogate pair takes four bytes, two per unit.
+        const auto Units = Load( pData + i );
+
+        counts = vsubq_u16( counts, vcgeq_u16( Units, vdupq_n_u16( 0x80 ) ) );
+        counts = vsubq_u16( counts, vcgeq_u16( Units, vdupq_n_u16( 0x800 ) ) );
+        counts = vaddq_u16( counts, IsSurrogate( Units ) );
+      }
+
+      extra += vaddlvq_u16( counts );
+    }
+
+    return i + extra + Scalar::Utf8LengthFromUtf16( utf16Str.substr( i ) );
+  }
+
+  size Utf8LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+
+    size extra = 0;
+    size i     = 0;
+    while ( i + 4 <= Length )
+    {
+      const auto End    = std::min( Length - 3, i + 65536 * 4 );
+      auto       counts = vdupq_n_u32( 0 );
+      for ( ; i < End; i += 4 )
+      {
+        const auto Units = Load( pData + i );
+        for ( const u32 Bound : { 0x7Fu, 0x7FFu, 0xFFFFu } )
+        {
+          counts = vsubq_u32( counts, vcgtq_u32( Units, vdupq_n_u32( Bound ) ) );
+        }
+      }
+
+      extra += vaddvq_u32( counts );
+    }
+
+    return i + extra + Scalar::Utf8LengthFromUtf32( utf32Str.substr( i ) );
+  }
+
+  // The loops below stop 16 units short of the end: every unit left over
+  // needs at least one byte, so the 16-byte stores stay inside the output.
+  size ConvertUtf16ToUtf8( const std::u16string_view utf16Str, c8 * pOut )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 16 <= Length )
+    {
+      const auto Units0 = Load( pData + i );
+      const auto Units1 = Load( pData + i + 8 );
+      if ( vmaxvq_u16( vorrq_u16( Units0, Units1 ) ) < 0x80 )
+      {
+        vst1q_u8( reinterpret_cast<u8 *>( pWrite ),
+                  vcombine_u8( vmovn_u16( Units0 ), vmovn_u16( Units1 ) ) );
+        i      += 16;
+        pWrite += 16;
+      }
+      else if ( vmaxvq_u16( Units0 ) < 0x800 )
+      {
+        pWrite += PackTwoByte( Units0, pWrite );
+        i      += 8;
+      }
+      else if ( vmaxvq_u16( IsSurrogate( Units0 ) ) == 0 )
+      {
+        for ( const auto End = i + 8; i < End; ++i )
+        {
+          pWrite += EncodeUtf8( pData[ i ], pWrite );
+        }
+      }
+      else
+      {
+        for ( const auto End = i + 8; i < End; /**/ )
+        {
+          u32 codePoint  = 0;
+          i             += DecodeValidUtf16( pData + i, codePoint );
+          pWrite        += EncodeUtf8( codePoint, pWrite );
+        }
+      }
+    }
+
+    pWrite += Scalar::ConvertUtf16ToUtf8( utf16Str.substr( i ), pWrite );
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  size ConvertUtf32ToUtf8( const std::u32string_view utf32Str, c8 * pOut )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 16 <= Length )
+    {
+      // Saturating to 16 bits keeps anything above U+FFFF off the fast paths.
+      const auto Units0 = vcombine_u16( vqmovn_u32( Load( pData + i ) ),
+                                        vqmovn_u32( Load( pData + i + 4 ) ) );
+      const auto Units1 = vcombine_u16( vqmovn_u32( Load( pData + i + 8 ) ),
+                                        vqmovn_u32( Load( pData + i + 12 ) ) );
+      if ( vmaxvq_u16( vorrq_u16( Units0, Units1 ) ) < 0x80 )
+      {
+        vst1q_u8( reinterpret_cast<u8 *>( pWrite ),
+                  vcombine_u8( vmovn_u16( Units0 ), vmovn_u16( Units1 ) ) );
+        i      += 16;
+        pWrite += 16;
+      }
+      else if ( vmaxvq_u16( Units0 ) < 0x800 )
+      {
+        pWrite += PackTwoByte( Units0, pWrite );
+        i      += 8;
+      }
+      else
+      {
+        for ( const auto End = i + 8; i < End; ++i )
+        {
+          pWrite += EncodeUtf8( pData[ i ], pWrite );
+        }
+      }
+    }
+
+    pWrite += Scalar::ConvertUtf32ToUtf8( utf32Str.substr( i ), pWrite );
+    return static_cast<size>( pWrite - pOut );
+  }
+#else
+  bool IsUtf8( const std::string_view str )
+  {
+    return Scalar::IsUtf8( str );
+  }
+
+  size Utf16LengthFromUtf8( const std::string_view str )
+  {
+    return Scalar::Utf16LengthFromUtf8( str );
+  }
+
+  size Utf32LengthFromUtf8( const std::string_view str )
+  {
+    return Scalar::Utf32LengthFromUtf8( str );
+  }
+
+  size ConvertUtf8ToUtf16( const std::string_view str, c16 * pOut )
+  {
+    return Scalar::ConvertUtf8ToUtf16( str, pOut );
+  }
+
+  size ConvertUtf8ToUtf32( const std::string_view str, c32 * pOut )
+  {
+    return Scalar::ConvertUtf8ToUtf32( str, pOut );
+  }
+
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    return Scalar::IsUtf16( utf16Str );
+  }
+
+  bool IsUtf32( const std::u32string_view utf32Str )
+  {
+    return Scalar::IsUtf32( utf32Str );
+  }
+
+  size Utf8LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    return Scalar::Utf8LengthFromUtf16( utf16Str );
+  }
+
+  size Utf8LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    return Scalar::Utf8LengthFromUtf32( utf32Str );
+  }
+
+  size ConvertUtf16ToUtf8( const std::u16string_view utf16Str, c8 * pOut )
+  {
+    return Scalar::ConvertUtf16ToUtf8( utf16Str, pOut );
+  }
+
+  size ConvertUtf32ToUtf8( const std::u32string_view utf32Str, c8 * pOut )
+  {
+    return Scalar::ConvertUtf32ToUtf8( utf32Str, pOut );
+  }
+#endif
+} // namespace Engine::Utility::Unicode::Neon
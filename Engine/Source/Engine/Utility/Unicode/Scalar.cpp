@@ -0,0 +1,330 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include "Engine/Utility/Unicode/CodePoint.hpp"
+
+#include "Engine/Utility/Unicode/UnicodeKernels.hpp"
+
+namespace Engine::Utility::Unicode::Scalar
+{
+  size ValidUtf8Length( const std::string_view str )
+  {
+    for ( size i = 0; i < str.length(); /**/ )
+    {
+      if ( const auto Byte1 = static_cast<u8>( str[ i ] ); Byte1 < 0x80 )
+      {
+        i += 1;
+      }
+      else if ( Byte1 >> 5 == 0b110 )
+      {
+        if ( i + 1 >= str.length() )
+        {
+          return i;
+        }
+
+        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
+        if ( ( Byte2 & 0xC0 ) != 0x80 )
+        {
+          return i;
+        }
+
+        if ( const auto CodePoint = ( Byte1 & 0x1F ) << 6 | Byte2 & 0x3F;
+             CodePoint < 0x80 )
+        {
+          return i;
+        }
+
+        i += 2;
+      }
+      else if ( Byte1 >> 4 == 0b1110 )
+      {
+        if ( i + 2 >= str.length() )
+        {
+          return i;
+        }
+
+        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
+        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
+        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 )
+        {
+          return i;
+        }
+
+        const auto CodePoint =
+          ( Byte1 & 0x0F ) << 12 | ( Byte2 & 0x3F ) << 6 | Byte3 & 0x3F;
+        if ( CodePoint < 0x800 || ( CodePoint >= 0xD800 && CodePoint <= 0xDFFF ) )
+        {
+          return i;
+        }
+
+        i += 3;
+      }
+      else if ( Byte1 >> 3 == 0b11110 )
+      {
+        if ( i + 3 >= str.length() )
+        {
+          return i;
+        }
+
+        const auto Byte2 = static_cast<u8>( str[ i + 1 ] );
+        const auto Byte3 = static_cast<u8>( str[ i + 2 ] );
+        const auto Byte4 = static_cast<u8>( str[ i + 3 ] );
+        if ( ( Byte2 & 0xC0 ) != 0x80 || ( Byte3 & 0xC0 ) != 0x80 ||
+             ( Byte4 & 0xC0 ) != 0x80 )
+        {
+          return i;
+        }
+
+        const auto CodePoint = ( Byte1 & 0x07 ) << 18 | ( Byte2 & 0x3F ) << 12 |
+                               ( Byte3 & 0x3F ) << 6 | Byte4 & 0x3F;
+        if ( CodePoint < 0x10000 || CodePoint > 0x10FFFF )
+        {
+          return i;
+        }
+
+        i += 4;
+      }
+      else
+      {
+        return i;
+      }
+    }
+
+    return str.length();
+  }
+
+  bool IsUtf8( const std::string_view str )
+  {
+    return ValidUtf8Length( str ) == str.length();
+  }
+
+  size ValidUtf16Length( const std::u16string_view utf16Str )
+  {
+    for ( size i = 0; i < utf16Str.length(); /**/ )
+    {
+      if ( const auto Unit1 = utf16Str[ i ]; Unit1 < 0xD800 || Unit1 > 0xDFFF )
+      {
+        i += 1;
+      }
+      else if ( Unit1 >= 0xD800 && Unit1 <= 0xDBFF )
+      {
+        if ( i + 1 >= utf16Str.length() )
+        {
+          return i;
+        }
+
+        if ( const auto Unit2 = utf16Str[ i + 1 ]; Unit2 < 0xDC00 || Unit2 > 0xDFFF )
+        {
+          return i;
+        }
+
+        i += 2;
+      }
+      else
+      {
+        return i;
+      }
+    }
+
+    return utf16Str.length();
+  }
+
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    return ValidUtf16Length( utf16Str ) == utf16Str.length();
+  }
+
+  size ValidUtf32Length( const std::u32string_view utf32Str )
+  {
+    for ( size i = 0; i < utf32Str.length(); ++i )
+    {
+      if ( const auto CodePoint = utf32Str[ i ];
+           CodePoint > 0x10FFFF || ( CodePoint >= 0xD800 && CodePoint <= 0xDFFF ) )
+      {
+        return i;
+      }
+    }
+
+    return utf32Str.length();
+  }
+
+  bool IsUtf32( const std::u32string_view utf32Str )
+  {
+    return ValidUtf32Length( utf32Str ) == utf32Str.length();
+  }
+
+  size Utf16LengthFromUtf8( const std::string_view str )
+  {
+    size length = 0;
+    for ( const auto Char : str )
+    {
+      // Every non-continuation byte starts a code point; four-byte sequences
+      // become surrogate pairs.
+      const auto Byte  = static_cast<u8>( Char );
+      length          += ( Byte & 0xC0 ) != 0x80;
+      length          += Byte >= 0xF0;
+    }
+
+    return length;
+  }
+
+  size Utf32LengthFromUtf8( const std::string_view str )
+  {
+    size length = 0;
+    for ( const auto Char : str )
+    {
+      length += ( static_cast<u8>( Char ) & 0xC0 ) != 0x80;
+    }
+
+    return length;
+  }
+
+  size ConvertUtf8ToUtf16( const std::string_view str, c16 * pOut )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    auto *       pWrite = pOut;
+
+    for ( size i = 0; i < str.length(); /**/ )
+    {
+      u32 codePoint  = 0;
+      i             += DecodeValidUtf8( pData + i, codePoint );
+      pWrite        += EncodeUtf16( codePoint, pWrite );
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  size ConvertUtf8ToUtf32( const std::string_view str, c32 * pOut )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    auto *       pWrite = pOut;
+
+    for ( size i = 0; i < str.length(); /**/ )
+    {
+      u32 codePoint  = 0;
+      i             += DecodeValidUtf8( pData + i, codePoint );
+      *pWrite++      = codePoint;
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  size Utf8LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    size length = 0;
+    for ( const auto Unit : utf16Str )
+    {
+      // A surrogate pair takes four bytes, two per unit.
+      if ( Unit < 0x80 )
+      {
+        length += 1;
+      }
+      else if ( Unit < 0x800 || ( Unit >= 0xD800 && Unit <= 0xDFFF ) )
+      {
+        length += 2;
+      }
+      else
+      {
+        length += 3;
+      }
+    }
+
+    return length;
+  }
+
+  size Utf8LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    size length = 0;
+    for ( const auto CodePoint : utf32Str )
+    {
+      length += 1 + ( CodePoint >= 0x80 ) + ( CodePoint >= 0x800 ) +
+                ( CodePoint >= 0x10000 );
+    }
+
+    return length;
+  }
+
+  size ConvertUtf16ToUtf8( const std::u16string_view utf16Str, c8 * pOut )
+  {
+    auto * pWrite = pOut;
+
+    for ( size i = 0; i < utf16Str.length(); /**/ )
+    {
+      u32 codePoint  = 0;
+      i             += DecodeValidUtf16( utf16Str.data() + i, codePoint );
+      pWrite        += EncodeUtf8( codePoint, pWrite );
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  size ConvertUtf32ToUtf8( const std::u32string_view utf32Str, c8 * pOut )
+  {
+    auto * pWrite = pOut;
+
+    for ( const auto CodePoint : utf32Str )
+    {
+      pWrite += EncodeUtf8( CodePoint, pWrite );
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  size Utf16LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    size length = 0;
+    for ( const auto CodePoint : utf32Str )
+    {
+      length += CodePoint > 0xFFFF ? 2 : 1;
+    }
+
+    return length;
+  }
+
+  size Utf32LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    size length = 0;
+    for ( const auto Unit : utf16Str )
+    {
+      // Low surrogates finish a pair already counted at the high one.
+      length += Unit < 0xDC00 || Unit > 0xDFFF;
+    }
+
+    return length;
+  }
+
+  size ConvertUtf32ToUtf16( const std::u32string_view utf32Str, c16 * pOut )
+  {
+    auto * pWrite = pOut;
+
+    for ( const auto CodePoint : utf32Str )
+    {
+      pWrite += EncodeUtf16( CodePoint, pWrite );
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  size ConvertUtf16ToUtf32( const std::u16string_view utf16Str, c32 * pOut )
+  {
+    auto * pWrite = pOut;
+
+    for ( size i = 0; i < utf16Str.length(); /**/ )
+    {
+      u32 codePoint  = 0;
+      i             += DecodeValidUtf16( utf16Str.data() + i, codePoint );
+      *pWrite++      = codePoint;
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+} // namespace Engine::Utility::Unicode::Scalar
@@ -0,0 +1,594 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include "Engine/Core/Macro.hpp"
+
+#if defined( TRIUMPH_ARCH_X64 )
+#include <immintrin.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "Engine/Utility/Unicode/CodePoint.hpp"
+#include "Engine/Utility/Unicode/Utf8Lookup.hpp"
+#endif
+
+#include "Engine/Utility/Unicode/UnicodeKernels.hpp"
+
+namespace Engine::Utility::Unicode::Sse4
+{
+#if defined( TRIUMPH_ARCH_X64 )
+  struct Utf8State
+  {
+    __m128i m_Error;
+    __m128i m_PrevInput;
+    __m128i m_PrevIncomplete;
+  };
+
+  TARGET_ISA( "sse4.1" )
+  static __m128i Load( const void * pData )
+  {
+    return _mm_loadu_si128( static_cast<const __m128i *>( pData ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static __m128i HighNibbles( const __m128i input )
+  {
+    return _mm_and_si128( _mm_srli_epi16( input, 4 ), _mm_set1_epi8( 0x0F ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static __m128i CheckUtf8Chunk( const __m128i input, const __m128i prevInput )
+  {
+    using namespace Utf8Lookup;
+
+    const auto Prev1 = _mm_alignr_epi8( input, prevInput, 16 - 1 );
+    const auto Prev2 = _mm_alignr_epi8( input, prevInput, 16 - 2 );
+    const auto Prev3 = _mm_alignr_epi8( input, prevInput, 16 - 3 );
+
+    const auto Byte1High =
+      _mm_shuffle_epi8( Load( s_Byte1High.data() ), HighNibbles( Prev1 ) );
+    const auto Byte1Low = _mm_shuffle_epi8(
+      Load( s_Byte1Low.data() ), _mm_and_si128( Prev1, _mm_set1_epi8( 0x0F ) ) );
+    const auto Byte2High =
+      _mm_shuffle_epi8( Load( s_Byte2High.data() ), HighNibbles( input ) );
+    const auto Special =
+      _mm_and_si128( _mm_and_si128( Byte1High, Byte1Low ), Byte2High );
+
+    // Third and fourth bytes of a sequence must be continuations; the tables
+    // flag those as two continuations in a row, which this cancels out.
+    const auto IsThird  = _mm_subs_epu8( Prev2, _mm_set1_epi8( 0xE0 - 0x80 ) );
+    const auto IsFourth = _mm_subs_epu8( Prev3, _mm_set1_epi8( 0xF0 - 0x80 ) );
+    const auto Must23   = _mm_and_si128( _mm_or_si128( IsThird, IsFourth ),
+                                         _mm_set1_epi8( -0x80 ) );
+    return _mm_xor_si128( Must23, Special );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static void CheckUtf8Block( const u8 * pBlock, Utf8State & state )
+  {
+    const auto Input0 = Load( pBlock );
+    const auto Input1 = Load( pBlock + 16 );
+    const auto Input2 = Load( pBlock + 32 );
+    const auto Input3 = Load( pBlock + 48 );
+
+    const auto Any = _mm_or_si128( _mm_or_si128( Input0, Input1 ),
+                                   _mm_or_si128( Input2, Input3 ) );
+    if ( _mm_movemask_epi8( Any ) == 0 )
+    {
+      // All ASCII: only a sequence left open by the previous block can fail.
+      state.m_Error          = _mm_or_si128( state.m_Error, state.m_PrevIncomplete );
+      state.m_PrevInput      = Input3;
+      state.m_PrevIncomplete = _mm_setzero_si128();
+      return;
+    }
+
+    auto error = CheckUtf8Chunk( Input0, state.m_PrevInput );
+    error      = _mm_or_si128( error, CheckUtf8Chunk( Input1, Input0 ) );
+    error      = _mm_or_si128( error, CheckUtf8Chunk( Input2, Input1 ) );
+    error      = _mm_or_si128( error, CheckUtf8Chunk( Input3, Input2 ) );
+
+    state.m_Error     = _mm_or_si128( state.m_Error, error );
+    state.m_PrevInput = Input3;
+    state.m_PrevIncomplete =
+      _mm_subs_epu8( Input3, Load( Utf8Lookup::s_IncompleteMax.data() + 16 ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  bool IsUtf8( const std::string_view str )
+  {
+    const auto * pData = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+
+    Utf8State state { _mm_setzero_si128(), _mm_setzero_si128(),
+                      _mm_setzero_si128() };
+
+    size i = 0;
+    for ( ; i + 64 <= Length; i += 64 )
+    {
+      CheckUtf8Block( pData + i, state );
+    }
+
+    if ( i < Length )
+    {
+      u8 tail[ 64 ] = {};
+      std::memcpy( tail, pData + i, Length - i );
+      CheckUtf8Block( tail, state );
+    }
+
+    const auto Error = _mm_or_si128( state.m_Error, state.m_PrevIncomplete );
+    return _mm_testz_si128( Error, Error ) != 0;
+  }
+
+  // Counts code points (and, for UTF-16, the extra unit of each surrogate
+  // pair) in byte lanes, folding them into 64-bit sums before a lane can
+  // overflow.
+  template <bool CountPairs>
+  TARGET_ISA( "sse4.1" )
+  static size CountUtf8( const std::string_view str )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+
+    auto total = _mm_setzero_si128();
+    size i     = 0;
+    while ( i + 16 <= Length )
+    {
+      const auto End    = std::min( Length - 15, i + 127 * 16 );
+      auto       counts = _mm_setzero_si128();
+      for ( ; i < End; i += 16 )
+      {
+        const auto Input = Load( pData + i );
+        const auto Lead  = _mm_cmpgt_epi8( Input, _mm_set1_epi8( -65 ) );
+        counts           = _mm_sub_epi8( counts, Lead );
+        if constexpr ( CountPairs )
+        {
+          const auto Four =
+            _mm_cmpeq_epi8( _mm_max_epu8( Input, _mm_set1_epi8( -16 ) ), Input );
+          counts = _mm_sub_epi8( counts, Four );
+        }
+      }
+
+      total = _mm_add_epi64( total, _mm_sad_epu8( counts, _mm_setzero_si128() ) );
+    }
+
+    const auto Tail = str.substr( i );
+    const auto Sum  = static_cast<size>( _mm_cvtsi128_si64( total ) ) +
+                     static_cast<size>( _mm_extract_epi64( total, 1 ) );
+    return Sum + ( CountPairs ? Scalar::Utf16LengthFromUtf8( Tail )
+                              : Scalar::Utf32LengthFromUtf8( Tail ) );
+  }
+
+  // Widens all-ASCII chunks directly and decodes the rest one sequence at a
+  // time.
+  template <typename Char>
+  TARGET_ISA( "sse4.1" )
+  static size ConvertUtf8( const std::string_view str, Char * pOut )
+  {
+    const auto * pData  = reinterpret_cast<const u8 *>( str.data() );
+    const auto   Length = str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 16 <= Length )
+    {
+      const auto Input = Load( pData + i );
+      const auto Mask  = static_cast<u32>( _mm_movemask_epi8( Input ) );
+      if ( Mask == 0 )
+      {
+        const auto Zero = _mm_setzero_si128();
+        const auto Low  = _mm_unpacklo_epi8( Input, Zero );
+        const auto High = _mm_unpackhi_epi8( Input, Zero );
+        auto *     pDst = reinterpret_cast<__m128i *>( pWrite );
+        if constexpr ( sizeof( Char ) == 2 )
+        {
+          _mm_storeu_si128( pDst, Low );
+          _mm_storeu_si128( pDst + 1, High );
+        }
+        else
+        {
+          _mm_storeu_si128( pDst, _mm_unpacklo_epi16( Low, Zero ) );
+          _mm_storeu_si128( pDst + 1, _mm_unpackhi_epi16( Low, Zero ) );
+          _mm_storeu_si128( pDst + 2, _mm_unpacklo_epi16( High, Zero ) );
+          _mm_storeu_si128( pDst + 3, _mm_unpackhi_epi16( High, Zero ) );
+        }
+
+        i      += 16;
+        pWrite += 16;
+        continue;
+      }
+
+      // Copy the ASCII run up to the first sequence, then decode until the
+      // next ASCII byte so the following load starts on fresh data.
+      for ( auto run = std::countr_zero( Mask ); run > 0; --run )
+      {
+        *pWrite++ = pData[ i++ ];
+      }
+
+      do
+      {
+        u32 codePoint  = 0;
+        i             += DecodeValidUtf8( pData + i, codePoint );
+        if constexpr ( sizeof( Char ) == 2 )
+        {
+          pWrite += EncodeUtf16( codePoint, pWrite );
+        }
+        else
+        {
+          *pWrite++ = codePoint;
+        }
+      } while ( i < Length && pData[ i ] >= 0x80 );
+    }
+
+    const auto Tail = str.substr( i );
+    if constexpr ( sizeof( Char ) == 2 )
+    {
+      pWrite += Scalar::ConvertUtf8ToUtf16( Tail, pWrite );
+    }
+    else
+    {
+      pWrite += Scalar::ConvertUtf8ToUtf32( Tail, pWrite );
+    }
+
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  size Utf16LengthFromUtf8( const std::string_view str )
+  {
+    return CountUtf8<true>( str );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  size Utf32LengthFromUtf8( const std::string_view str )
+  {
+    return CountUtf8<false>( str );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  size ConvertUtf8ToUtf16( const std::string_view str, c16 * pOut )
+  {
+    return ConvertUtf8( str, pOut );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  size ConvertUtf8ToUtf32( const std::string_view str, c32 * pOut )
+  {
+    return ConvertUtf8( str, pOut );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static __m128i Splat16( const u16 value )
+  {
+    return _mm_set1_epi16( static_cast<i16>( value ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static __m128i Splat32( const u32 value )
+  {
+    return _mm_set1_epi32( static_cast<i32>( value ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static __m128i IsAtLeast( const __m128i units, const u16 value )
+  {
+    return _mm_cmpeq_epi16( _mm_max_epu16( units, Splat16( value ) ), units );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static __m128i IsSurrogate( const __m128i units )
+  {
+    return _mm_cmpeq_epi16( _mm_and_si128( units, Splat16( 0xF800 ) ),
+                            Splat16( 0xD800 ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static bool HasSurrogate( const __m128i units )
+  {
+    return _mm_movemask_epi8( IsSurrogate( units ) ) != 0;
+  }
+
+  TARGET_ISA( "sse4.1" )
+  static bool HasBitsSet( const __m128i units, const u16 mask )
+  {
+    return _mm_testz_si128( units, Splat16( mask ) ) == 0;
+  }
+
+  // Encodes eight units below U+0800 and stores 16 bytes, of which the
+  // returned count are used; the caller keeps enough output to spare.
+  TARGET_ISA( "sse4.1" )
+  static size PackTwoByte( const __m128i units, c8 * pOut )
+  {
+    const auto Lead  = _mm_or_si128( _mm_srli_epi16( units, 6 ), Splat16( 0xC0 ) );
+    const auto Low   = _mm_and_si128( units, Splat16( 0x3F ) );
+    const auto Cont  = _mm_or_si128( Low, Splat16( 0x80 ) );
+    const auto Pair  = _mm_or_si128( Lead, _mm_slli_epi16( Cont, 8 ) );
+    const auto IsTwo = _mm_cmpgt_epi16( units, Splat16( 0x7F ) );
+    const auto Words = _mm_blendv_epi8( units, Pair, IsTwo );
+
+    const auto Mask    = static_cast<u32>(
+      _mm_movemask_epi8( _mm_packs_epi16( IsTwo, _mm_setzero_si128() ) ) );
+    const auto Shuffle = Load( Utf8Lookup::s_PackTwoByte[ Mask ].data() );
+    _mm_storeu_si128( reinterpret_cast<__m128i *>( pOut ),
+                      _mm_shuffle_epi8( Words, Shuffle ) );
+    return 8 + static_cast<size>( std::popcount( Mask ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+
+    size i = 0;
+    while ( i + 8 <= Length )
+    {
+      if ( !HasSurrogate( Load( pData + i ) ) )
+      {
+        i += 8;
+        continue;
+      }
+
+      // Check pairing a code point at a time; a pair may straddle chunks.
+      for ( const auto End = i + 8; i < End; /**/ )
+      {
+        if ( const auto Unit = pData[ i ]; Unit < 0xD800 || Unit > 0xDFFF )
+        {
+          i += 1;
+        }
+        else if ( Unit <= 0xDBFF && i + 1 < Length && pData[ i + 1 ] >= 0xDC00 &&
+                  pData[ i + 1 ] <= 0xDFFF )
+        {
+          i += 2;
+        }
+        else
+        {
+          return false;
+        }
+      }
+    }
+
+    return Scalar::IsUtf16( utf16Str.substr( i ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  bool IsUtf32( const std::u32string_view utf32Str )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+    const auto   Limit  = Splat32( 0x10FFFF );
+
+    auto max       = _mm_setzero_si128();
+    auto surrogate = _mm_setzero_si128();
+    size i         = 0;
+    for ( ; i + 4 <= Length; i += 4 )
+    {
+      const auto Units  = Load( pData + i );
+      const auto Masked = _mm_and_si128( Units, Splat32( 0xFFFFF800 ) );
+      max               = _mm_max_epu32( max, Units );
+      surrogate =
+        _mm_or_si128( surrogate, _mm_cmpeq_epi32( Masked, Splat32( 0xD800 ) ) );
+    }
+
+    const auto InRange = _mm_cmpeq_epi32( _mm_max_epu32( max, Limit ), Limit );
+    return _mm_movemask_epi8( InRange ) == 0xFFFF &&
+           _mm_testz_si128( surrogate, surrogate ) &&
+           Scalar::IsUtf32( utf32Str.substr( i ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  size Utf8LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+
+    // Every unit is at least one byte; count the extra bytes in 16-bit lanes.
+    size extra = 0;
+    size i     = 0;
+    while ( i + 8 <= Length )
+    {
+      const auto End    = std::min( Length - 7, i + 8192 * 8 );
+      auto       counts = _mm_setzero_si128();
+      for ( ; i < End; i += 8 )
+      {
+        // A surrogate pair takes four bytes, two per unit.
+        const auto Units = Load( pData + i );
+        counts           = _mm_sub_epi16( counts, IsAtLeast( Units, 0x80 ) );
+        counts           = _mm_sub_epi16( counts, IsAtLeast( Units, 0x800 ) );
+        counts           = _mm_add_epi16( counts, IsSurrogate( Units ) );
+      }
+
+      auto sums  = _mm_madd_epi16( counts, Splat16( 1 ) );
+      sums       = _mm_hadd_epi32( sums, sums );
+      sums       = _mm_hadd_epi32( sums, sums );
+      extra     += static_cast<u32>( _mm_cvtsi128_si32( sums ) );
+    }
+
+    return i + extra + Scalar::Utf8LengthFromUtf16( utf16Str.substr( i ) );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  size Utf8LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+
+    size extra = 0;
+    size i     = 0;
+    while ( i + 4 <= Length )
+    {
+      const auto End    = std::min( Length - 3, i + 65536 * 4 );
+      auto       counts = _mm_setzero_si128();
+      for ( ; i < End; i += 4 )
+      {
+        // Valid code points are positive, so the signed compares hold.
+        const auto Units = Load( pData + i );
+        for ( const u32 Bound : { 0x7Fu, 0x7FFu, 0xFFFFu } )
+        {
+          const auto Above = _mm_cmpgt_epi32( Units, Splat32( Bound ) );
+          counts           = _mm_sub_epi32( counts, Above );
+        }
+      }
+
+      counts  = _mm_hadd_epi32( counts, counts );
+      counts  = _mm_hadd_epi32( counts, counts );
+      extra  += static_cast<u32>( _mm_cvtsi128_si32( counts ) );
+    }
+
+    return i + extra + Scalar::Utf8LengthFromUtf32( utf32Str.substr( i ) );
+  }
+
+  // The loops below stop 16 units short of the end: every unit left over
+  // needs at least one byte, so the 16-byte stores stay inside the output.
+  TARGET_ISA( "sse4.1" )
+  size ConvertUtf16ToUtf8( const std::u16string_view utf16Str, c8 * pOut )
+  {
+    const auto * pData  = utf16Str.data();
+    const auto   Length = utf16Str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 16 <= Length )
+    {
+      const auto Units0 = Load( pData + i );
+      const auto Units1 = Load( pData + i + 8 );
+      if ( !HasBitsSet( _mm_or_si128( Units0, Units1 ), 0xFF80 ) )
+      {
+        _mm_storeu_si128( reinterpret_cast<__m128i *>( pWrite ),
+                          _mm_packus_epi16( Units0, Units1 ) );
+        i      += 16;
+        pWrite += 16;
+      }
+      else if ( !HasBitsSet( Units0, 0xF800 ) )
+      {
+        pWrite += PackTwoByte( Units0, pWrite );
+        i      += 8;
+      }
+      else if ( !HasSurrogate( Units0 ) )
+      {
+        for ( const auto End = i + 8; i < End; ++i )
+        {
+          pWrite += EncodeUtf8( pData[ i ], pWrite );
+        }
+      }
+      else
+      {
+        for ( const auto End = i + 8; i < End; /**/ )
+        {
+          u32 codePoint  = 0;
+          i             += DecodeValidUtf16( pData + i, codePoint );
+          pWrite        += EncodeUtf8( codePoint, pWrite );
+        }
+      }
+    }
+
+    pWrite += Scalar::ConvertUtf16ToUtf8( utf16Str.substr( i ), pWrite );
+    return static_cast<size>( pWrite - pOut );
+  }
+
+  TARGET_ISA( "sse4.1" )
+  size ConvertUtf32ToUtf8( const std::u32string_view utf32Str, c8 * pOut )
+  {
+    const auto * pData  = utf32Str.data();
+    const auto   Length = utf32Str.length();
+    auto *       pWrite = pOut;
+
+    size i = 0;
+    while ( i + 16 <= Length )
+    {
+      // Saturating to 16 bits keeps anything above U+FFFF off the fast paths.
+      const auto Units0 =
+        _mm_packus_epi32( Load( pData + i ), Load( pData + i + 4 ) );
+      const auto Units1 =
+        _mm_packus_epi32( Load( pData + i + 8 ), Load( pData + i + 12 ) );
+      if ( !HasBitsSet( _mm_or_si128( Units0, Units1 ), 0xFF80 ) )
+      {
+        _mm_storeu_si128( reinterpret_cast<__m128i *>( pWrite ),
+                          _mm_packus_epi16( Units0, Units1 ) );
+        i      += 16;
+        pWrite += 16;
+      }
+      else if ( !HasBitsSet( Units0, 0xF800 ) )
+      {
+        pWrite += PackTwoByte( Units0, pWrite );
+        i      += 8;
+      }
+      else
+      {
+        for ( const auto End = i + 8; i < End; ++i )
+        {
+          pWrite += EncodeUtf8( pData[ i ], pWrite );
+        }
+      }
+    }
+
+    pWrite += Scalar::ConvertUtf32ToUtf8( utf32Str.substr( i ), pWrite );
+    return static_cast<size>( pWrite - pOut );
+  }
+#else
+  bool IsUtf8( const std::string_view str )
+  {
+    return Scalar::IsUtf8( str );
+  }
+
+  size Utf16LengthFromUtf8( const std::string_view str )
+  {
+    return Scalar::Utf16LengthFromUtf8( str );
+  }
+
+  size Utf32LengthFromUtf8( const std::string_view str )
+  {
+    return Scalar::Utf32LengthFromUtf8( str );
+  }
+
+  size ConvertUtf8ToUtf16( const std::string_view str, c16 * pOut )
+  {
+    return Scalar::ConvertUtf8ToUtf16( str, pOut );
+  }
+
+  size ConvertUtf8ToUtf32( const std::string_view str, c32 * pOut )
+  {
+    return Scalar::ConvertUtf8ToUtf32( str, pOut );
+  }
+
+  bool IsUtf16( const std::u16string_view utf16Str )
+  {
+    return Scalar::IsUtf16( utf16Str );
+  }
+
+  bool IsUtf32( const std::u32string_view utf32Str )
+  {
+    return Scalar::IsUtf32( utf32Str );
+  }
+
+  size Utf8LengthFromUtf16( const std::u16string_view utf16Str )
+  {
+    return Scalar::Utf8LengthFromUtf16( utf16Str );
+  }
+
+  size Utf8LengthFromUtf32( const std::u32string_view utf32Str )
+  {
+    return Scalar::Utf8LengthFromUtf32( utf32Str );
+  }
+
+  size ConvertUtf16ToUtf8( const std::u16string_view utf16Str, c8 * pOut )
+  {
+    return Scalar::ConvertUtf16ToUtf8( utf16Str, pOut );
+  }
+
+  size ConvertUtf32ToUtf8( const std::u32string_view utf32Str, c8 * pOut )
+  {
+    return Scalar::ConvertUtf32ToUtf8( utf32Str, pOut );
+  }
+#endif
+} // namespace Engine::Utility::Unicode::Sse4
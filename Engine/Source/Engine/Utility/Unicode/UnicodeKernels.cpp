@@ -0,0 +1,163 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include "Engine/Core/Macro.hpp"
+
+#if defined( TRIUMPH_ARCH_X64 ) && defined( _MSC_VER )
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+#include "Engine/Utility/Unicode/UnicodeKernels.hpp"
+
+namespace Engine::Utility::Unicode
+{
+  static SimdLevel DetectSimdLevel()
+  {
+#if defined( TRIUMPH_ARCH_X64 ) && defined( _MSC_VER )
+    i32 info[ 4 ] = {};
+    __cpuid( info, 0 );
+    const auto MaxLeaf = info[ 0 ];
+
+    __cpuid( info, 1 );
+    const bool HasSse4   = ( info[ 2 ] & ( 1 << 19 ) ) != 0;
+    const bool HasOsSave = ( info[ 2 ] & ( 1 << 27 ) ) != 0;
+    const bool HasAvx    = ( info[ 2 ] & ( 1 << 28 ) ) != 0;
+
+    // AVX2 also needs the OS to preserve the upper YMM state.
+    if ( MaxLeaf >= 7 && HasOsSave && HasAvx && ( _xgetbv( 0 ) & 0x6 ) == 0x6 )
+    {
+      __cpuidex( info, 7, 0 );
+      if ( ( info[ 1 ] & ( 1 << 5 ) ) != 0 )
+      {
+        return SimdLevel::m_Avx2;
+      }
+    }
+
+    return HasSse4 ? SimdLevel::m_Sse4 : SimdLevel::m_Scalar;
+#elif defined( TRIUMPH_ARCH_X64 )
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx2" ) )
+    {
+      return SimdLevel::m_Avx2;
+    }
+
+    return __builtin_cpu_supports( "sse4.1" ) ? SimdLevel::m_Sse4
+                                              : SimdLevel::m_Scalar;
+#elif defined( TRIUMPH_ARCH_ARM64 )
+    // Advanced SIMD is mandatory on AArch64.
+    return SimdLevel::m_Neon;
+#else
+    return SimdLevel::m_Scalar;
+#endif
+  }
+
+  SimdLevel GetSimdLevel()
+  {
+    static const SimdLevel s_Level = DetectSimdLevel();
+    return s_Level;
+  }
+
+  const UnicodeKernels & GetUnicodeKernels( const SimdLevel level )
+  {
+    static constexpr UnicodeKernels s_Scalar {
+      .m_Level                = SimdLevel::m_Scalar,
+      .m_pIsUtf8              = &Scalar::IsUtf8,
+      .m_pIsUtf16             = &Scalar::IsUtf16,
+      .m_pIsUtf32             = &Scalar::IsUtf32,
+      .m_pUtf16LengthFromUtf8 = &Scalar::Utf16LengthFromUtf8,
+      .m_pUtf32LengthFromUtf8 = &Scalar::Utf32LengthFromUtf8,
+      .m_pConvertUtf8ToUtf16  = &Scalar::ConvertUtf8ToUtf16,
+      .m_pConvertUtf8ToUtf32  = &Scalar::ConvertUtf8ToUtf32,
+      .m_pUtf8LengthFromUtf16 = &Scalar::Utf8LengthFromUtf16,
+      .m_pUtf8LengthFromUtf32 = &Scalar::Utf8LengthFromUtf32,
+      .m_pConvertUtf16ToUtf8  = &Scalar::ConvertUtf16ToUtf8,
+      .m_pConvertUtf32ToUtf8  = &Scalar::ConvertUtf32ToUtf8,
+    };
+    static constexpr UnicodeKernels s_Sse4 {
+      .m_Level                = SimdLevel::m_Sse4,
+      .m_pIsUtf8              = &Sse4::IsUtf8,
+      .m_pIsUtf16             = &Sse4::IsUtf16,
+      .m_pIsUtf32             = &Sse4::IsUtf32,
+      .m_pUtf16LengthFromUtf8 = &Sse4::Utf16LengthFromUtf8,
+      .m_pUtf32LengthFromUtf8 = &Sse4::Utf32LengthFromUtf8,
+      .m_pConvertUtf8ToUtf16  = &Sse4::ConvertUtf8ToUtf16,
+      .m_pConvertUtf8ToUtf32  = &Sse4::ConvertUtf8ToUtf32,
+      .m_pUtf8LengthFromUtf16 = &Sse4::Utf8LengthFromUtf16,
+      .m_pUtf8LengthFromUtf32 = &Sse4::Utf8LengthFromUtf32,
+      .m_pConvertUtf16ToUtf8  = &Sse4::ConvertUtf16ToUtf8,
+      .m_pConvertUtf32ToUtf8  = &Sse4::ConvertUtf32ToUtf8,
+    };
+    static constexpr UnicodeKernels s_Avx2 {
+      .m_Level                = SimdLevel::m_Avx2,
+      .m_pIsUtf8              = &Avx2::IsUtf8,
+      .m_pIsUtf16             = &Avx2::IsUtf16,
+      .m_pIsUtf32             = &Avx2::IsUtf32,
+      .m_pUtf16LengthFromUtf8 = &Avx2::Utf16LengthFromUtf8,
+      .m_pUtf32LengthFromUtf8 = &Avx2::Utf32LengthFromUtf8,
+      .m_pConvertUtf8ToUtf16  = &Avx2::ConvertUtf8ToUtf16,
+      .m_pConvertUtf8ToUtf32  = &Avx2::ConvertUtf8ToUtf32,
+      .m_pUtf8LengthFromUtf16 = &Avx2::Utf8LengthFromUtf16,
+      .m_pUtf8LengthFromUtf32 = &Avx2::Utf8LengthFromUtf32,
+      .m_pConvertUtf16ToUtf8  = &Avx2::ConvertUtf16ToUtf8,
+      .m_pConvertUtf32ToUtf8  = &Avx2::ConvertUtf32ToUtf8,
+    };
+    static constexpr UnicodeKernels s_Neon {
+      .m_Level                = SimdLevel::m_Neon,
+      .m_pIsUtf8              = &Neon::IsUtf8,
+      .m_pIsUtf16             = &Neon::IsUtf16,
+      .m_pIsUtf32             = &Neon::IsUtf32,
+      .m_pUtf16LengthFromUtf8 = &Neon::Utf16LengthFromUtf8,
+      .m_pUtf32LengthFromUtf8 = &Neon::Utf32LengthFromUtf8,
+      .m_pConvertUtf8ToUtf16  = &Neon::ConvertUtf8ToUtf16,
+      .m_pConvertUtf8ToUtf32  = &Neon::ConvertUtf8ToUtf32,
+      .m_pUtf8LengthFromUtf16 = &Neon::Utf8LengthFromUtf16,
+      .m_pUtf8LengthFromUtf32 = &Neon::Utf8LengthFromUtf32,
+      .m_pConvertUtf16ToUtf8  = &Neon::ConvertUtf16ToUtf8,
+      .m_pConvertUtf32ToUtf8  = &Neon::ConvertUtf32ToUtf8,
+    };
+
+    const auto Supported = GetSimdLevel();
+    switch ( level )
+    {
+      case SimdLevel::m_Avx2:
+      {
+        return Supported == SimdLevel::m_Avx2 ? s_Avx2 : s_Scalar;
+      }
+
+      case SimdLevel::m_Sse4:
+      {
+        return Supported == SimdLevel::m_Avx2 || Supported == SimdLevel::m_Sse4
+                 ? s_Sse4
+                 : s_Scalar;
+      }
+
+      case SimdLevel::m_Neon:
+      {
+        return Supported == SimdLevel::m_Neon ? s_Neon : s_Scalar;
+      }
+
+      case SimdLevel::m_Scalar:
+      {
+        break;
+      }
+    }
+
+    return s_Scalar;
+  }
+
+  const UnicodeKernels & GetUnicodeKernels()
+  {
+    static const UnicodeKernels & s_Kernels = GetUnicodeKernels( GetSimdLevel() );
+    return s_Kernels;
+  }
+} // namespace Engine::Utility::Unicode
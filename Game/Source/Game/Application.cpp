@@ -56,7 +56,8 @@ namespace Game
                           {
                             if ( event.m_Key == KeyCode::m_Escape )
                             {
-                              LOG_INFO( "Escape pressed.  Closing application" );
+                              LOG_INFO_CH( Game,
+                                           "Escape pressed.  Closing application" );
                               Close();
                             }
                           } );
@@ -65,15 +66,16 @@ namespace Game
       GetWindow(),
       [ this ]( const KeyPressedEvent & event )
       {
-        LOG_INFO( "Key pressed: {} (repeated: {}", static_cast<i32>( event.m_Key ),
-                  event.m_RepeatCount );
+        LOG_INFO_CH( Game, "Key pressed: {} (repeated: {}",
+                     static_cast<i32>( event.m_Key ), event.m_RepeatCount );
       } );
 
     m_MouseButtonPressedListener = MouseButtonPressedListener(
       GetWindow(),
       [ this ]( const MouseButtonPressedEvent & event )
       {
-        LOG_INFO( "Mouse button pressed: {}", static_cast<i32>( event.m_Button ) );
+        LOG_INFO_CH( Game, "Mouse button pressed: {}",
+                     static_cast<i32>( event.m_Button ) );
       } );
   }
 } // namespace Game
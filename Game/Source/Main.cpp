@@ -25,6 +25,6 @@ int main()
   }
   catch ( const std::exception & E )
   {
-    LOG_FATAL( E.what() );
+    LOG_FATAL_CH( Game, "{}", E.what() );
   }
 }
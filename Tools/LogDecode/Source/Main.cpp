@@ -0,0 +1,659 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <Engine/Utility/Logging/BinaryLogFormat.hpp>
+#include <Engine/Utility/Logging/LogArgs.hpp>
+
+// Turns a binary log written by Engine::Utility::BinaryFileSink back into text
+// or JSON lines.
+//
+//   TriumphLogDecode [--json] <input> [output]
+
+namespace
+{
+  using namespace Engine::Utility;
+
+  struct SiteInfo
+  {
+    u8                      m_Severity = 0;
+    u16                     m_Line     = 0;
+    std::vector<LogArgType> m_ArgTypes = {};
+    std::string             m_FileName;
+    std::string             m_FunctionName;
+    std::string             m_Format;
+  };
+
+  using Arg =
+    std::variant<bool, c8, i64, u64, f32, f64, const void *, std::string_view>;
+
+  class Reader
+  {
+  public:
+    explicit Reader( std::istream & stream )
+      : m_Stream( stream )
+    {
+    }
+
+    template <typename T> bool Read( T & value )
+    {
+      return static_cast<bool>( m_Stream.read( reinterpret_cast<char *>( &value ),
+                                               sizeof( T ) ) );
+    }
+
+    bool ReadBytes( void * pData, const size length )
+    {
+      auto * pChars = static_cast<char *>( pData );
+
+      return length == 0 ||
+             static_cast<bool>( m_Stream.read(
+               pChars, static_cast<std::streamsize>( length ) ) );
+    }
+
+    bool ReadString( std::string & text )
+    {
+      u32 length = 0;
+      if ( !Read( length ) )
+      {
+        return false;
+      }
+
+      text.resize( length );
+      return ReadBytes( text.data(), length );
+    }
+
+  private:
+    std::istream & m_Stream;
+  };
+
+  const char * GetSeverityName( const u8 severity )
+  {
+    constexpr const char * Names[] = { "TRACE", "INFO", "WARN", "ERROR", "FATAL" };
+
+    return severity < std::size( Names ) ? Names[ severity ] : "UNKNOWN";
+  }
+
+  template <typename T> T Load( const std::byte *& pData )
+  {
+    T value;
+    std::memcpy( &value, pData, sizeof( T ) );
+    pData += sizeof( T );
+    return value;
+  }
+
+  bool DecodeArgs( const std::vector<LogArgType> & types,
+                   const std::vector<std::byte> & payload, std::vector<Arg> & args )
+  {
+    const auto * pData = payload.data();
+    const auto * pEnd  = payload.data() + payload.size();
+
+    args.clear();
+
+    for ( const auto Type : types )
+    {
+      // Fixed part of each argument, indexed by LogArgType; strings start with
+      // a u32 length.
+      constexpr size Sizes[] = {
+        sizeof( bool ), sizeof( c8 ),  sizeof( i8 ),  sizeof( i16 ),
+        sizeof( i32 ),  sizeof( i64 ), sizeof( u8 ),  sizeof( u16 ),
+        sizeof( u32 ),  sizeof( u64 ), sizeof( f32 ), sizeof( f64 ),
+        sizeof( std::uintptr_t ), sizeof( u32 ) };
+
+      const auto Index = static_cast<size>( Type );
+      if ( Index >= std::size( Sizes ) ||
+           static_cast<size>( pEnd - pData ) < Sizes[ Index ] )
+      {
+        return false;
+      }
+
+      switch ( Type )
+      {
+        case LogArgType::m_Bool:
+        {
+          args.emplace_back( Load<bool>( pData ) );
+          break;
+        }
+
+        case LogArgType::m_Char:
+        {
+          args.emplace_back( Load<c8>( pData ) );
+          break;
+        }
+
+        case LogArgType::m_I8:
+        {
+          args.emplace_back( static_cast<i64>( Load<i8>( pData ) ) );
+          break;
+        }
+
+        case LogArgType::m_I16:
+        {
+          args.emplace_back( static_cast<i64>( Load<i16>( pData ) ) );
+          break;
+        }
+
+        case LogArgType::m_I32:
+        {
+          args.emplace_back( static_cast<i64>( Load<i32>( pData ) ) );
+          break;
+        }
+
+        case LogArgType::m_I64:
+        {
+          args.emplace_back( Load<i64>( pData ) );
+          break;
+        }
+
+        case LogArgType::m_U8:
+        {
+          args.emplace_back( static_cast<u64>( Load<u8>( pData ) ) );
+          break;
+        }
+
+        case LogArgType::m_U16:
+        {
+          args.emplace_back( static_cast<u64>( Load<u16>( pData ) ) );
+          break;
+        }
+
+        case LogArgType::m_U32:
+        {
+          args.emplace_back( static_cast<u64>( Load<u32>( pData ) ) );
+          break;
+        }
+
+        case LogArgType::m_U64:
+        {
+          args.emplace_back( Load<u64>( pData ) );
+          break;
+        }
+
+        case LogArgType::m_F32:
+        {
+          args.emplace_back( Load<f32>( pData ) );
+          break;
+        }
+
+        case LogArgType::m_F64:
+        {
+          args.emplace_back( Load<f64>( pData ) );
+          break;
+        }
+
+        case LogArgType::m_Pointer:
+        {
+          // #NOTE: Assumes the log was written by a build with the same pointer
+          //        size as the decoder.
+          args.emplace_back(
+            reinterpret_cast<const void *>( Load<std::uintptr_t>( pData ) ) );
+          break;
+        }
+
+        case LogArgType::m_String:
+        {
+          const auto Length = Load<u32>( pData );
+          if ( static_cast<size>( pEnd - pData ) < Length )
+          {
+            return false;
+          }
+
+          args.emplace_back(
+            std::string_view( reinterpret_cast<const c8 *>( pData ), Length ) );
+          pData += Length;
+          break;
+        }
+
+        case LogArgType::m_Opaque:
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // Finds the '}' closing the replacement field that opens at begin, skipping
+  // nested fields such as the width in "{:>{}}".
+  size FindFieldEnd( const std::string_view format, const size begin )
+  {
+    size depth = 0;
+    for ( size i = begin; i < format.size(); ++i )
+    {
+      if ( format[ i ] == '{' )
+      {
+        ++depth;
+      }
+      else if ( format[ i ] == '}' && --depth == 0 )
+      {
+        return i;
+      }
+    }
+
+    return std::string_view::npos;
+  }
+
+  size ParseArgIndex( const std::string_view id, size & nextIndex )
+  {
+    if ( id.empty() )
+    {
+      return nextIndex++;
+    }
+
+    size index = 0;
+    for ( const auto Digit : id )
+    {
+      index = index * 10 + static_cast<size>( Digit - '0' );
+    }
+
+    return index;
+  }
+
+  // Replaces each nested field in a format spec with the integer argument it
+  // names, the only kind std::format accepts there.
+  std::string ResolveSpec( const std::string_view spec,
+                           const std::vector<Arg> & args, size & nextIndex )
+  {
+    std::string resolved;
+
+    for ( size i = 0; i < spec.size(); ++i )
+    {
+      if ( spec[ i ] != '{' )
+      {
+        resolved += spec[ i ];
+        continue;
+      }
+
+      const auto End = spec.find( '}', i );
+      if ( End == std::string_view::npos )
+      {
+        throw std::format_error( "unterminated nested field" );
+      }
+
+      const auto Id        = spec.substr( i + 1, End - i - 1 );
+      const auto Index     = ParseArgIndex( Id, nextIndex );
+      const auto ToInteger = []( const auto & value ) -> std::string
+      {
+        using Value = std::decay_t<decltype( value )>;
+        if constexpr ( std::is_integral_v<Value> && !std::is_same_v<Value, bool> )
+        {
+          return std::to_string( value );
+        }
+        else
+        {
+          throw std::format_error( "nested field is not an integer" );
+        }
+      };
+
+      resolved += std::visit( ToInteger, args.at( Index ) );
+      i         = End;
+    }
+
+    return resolved;
+  }
+
+  // Applies a std::format string to runtime-typed arguments one replacement
+  // field at a time.
+  std::string FormatMessage( const std::string_view format,
+                             const std::vector<Arg> & args )
+  {
+    std::string out;
+    size        nextIndex = 0;
+
+    for ( size i = 0; i < format.size(); ++i )
+    {
+      const auto Char = format[ i ];
+
+      if ( Char == '}' )
+      {
+        i += i + 1 < format.size() && format[ i + 1 ] == '}';
+        out += '}';
+        continue;
+      }
+
+      if ( Char != '{' )
+      {
+        out += Char;
+        continue;
+      }
+
+      if ( i + 1 < format.size() && format[ i + 1 ] == '{' )
+      {
+        out += '{';
+        ++i;
+        continue;
+      }
+
+      const auto End = FindFieldEnd( format, i );
+      if ( End == std::string_view::npos )
+      {
+        out += format.substr( i );
+        break;
+      }
+
+      const auto Field = format.substr( i + 1, End - i - 1 );
+      const auto Colon = Field.find( ':' );
+
+      try
+      {
+        // The field's own argument is numbered before any nested ones.
+        const auto Index = ParseArgIndex( Field.substr( 0, Colon ), nextIndex );
+        const auto Spec =
+          Colon == std::string_view::npos
+            ? std::string( "{}" )
+            : std::format( "{{:{}}}", ResolveSpec( Field.substr( Colon + 1 ), args,
+                                                   nextIndex ) );
+
+        const auto Format = [ &Spec ]( const auto & value )
+        { return std::vformat( Spec, std::make_format_args( value ) ); };
+
+        out += std::visit( Format, args.at( Index ) );
+      }
+      catch ( ... )
+      {
+        out += format.substr( i, End - i + 1 );
+      }
+
+      i = End;
+    }
+
+    return out;
+  }
+
+  std::string FormatTime( const BinaryLogHeader & header, const u64 tick )
+  {
+    using namespace std::chrono;
+
+    const auto Elapsed = static_cast<i64>( tick - header.m_AnchorTick );
+    const auto Nanoseconds =
+      header.m_AnchorTime +
+      static_cast<i64>( static_cast<f64>( Elapsed ) * 1e9 /
+                        static_cast<f64>( header.m_TicksPerSecond ) );
+
+    // Local time, as the text sinks print it, so decoded lines match the
+    // console and file logs of the same run.
+    const auto Time   = floor<milliseconds>( nanoseconds( Nanoseconds ) );
+    const auto Second = floor<seconds>( Time );
+    const auto TimeT  = static_cast<std::time_t>( Second.count() );
+    std::tm    local  = {};
+
+#if defined( _WIN32 )
+    localtime_s( &local, &TimeT );
+#else
+    localtime_r( &TimeT, &local );
+#endif
+
+    return std::format( "{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:03}",
+                        local.tm_year + 1900, local.tm_mon + 1, local.tm_mday,
+                        local.tm_hour, local.tm_min, local.tm_sec,
+                        ( Time - Second ).count() );
+  }
+
+  void AppendJsonString( std::string & out, const std::string_view text )
+  {
+    out += '"';
+
+    for ( const auto Char : text )
+    {
+      switch ( Char )
+      {
+        case '"':
+        {
+          out += "\\\"";
+          break;
+        }
+
+        case '\\':
+        {
+          out += "\\\\";
+          break;
+        }
+
+        case '\n':
+        {
+          out += "\\n";
+          break;
+        }
+
+        case '\r':
+        {
+          out += "\\r";
+          break;
+        }
+
+        case '\t':
+        {
+          out += "\\t";
+          break;
+        }
+
+        default:
+        {
+          if ( static_cast<u8>( Char ) < 0x20 )
+          {
+            out += std::format( "\\u{:04x}", static_cast<u32>( Char ) );
+          }
+          else
+          {
+            out += Char;
+          }
+          break;
+        }
+      }
+    }
+
+    out += '"';
+  }
+
+  void WriteLine( std::ostream & output, const bool isJson, const std::string & time,
+                  const u64 tick, const u32 threadId, const SiteInfo & site,
+                  const std::string_view message )
+  {
+    std::string line;
+
+    if ( isJson )
+    {
+      line = std::format( "{{\"time\":\"{}\",\"tick\":{},\"thread\":{},"
+                          "\"severity\":\"{}\",\"file\":",
+                          time, tick, threadId, GetSeverityName( site.m_Severity ) );
+      AppendJsonString( line, site.m_FileName );
+      line += std::format( ",\"line\":{},\"function\":", site.m_Line );
+      AppendJsonString( line, site.m_FunctionName );
+      line += ",\"message\":";
+      AppendJsonString( line, message );
+      line += '}';
+    }
+    else
+    {
+      line = std::format( "[{}] [{}] [T{}] {}:{}({}) {}", time,
+                          GetSeverityName( site.m_Severity ), threadId,
+                          site.m_FileName, site.m_Line, site.m_FunctionName,
+                          message );
+    }
+
+    line += '\n';
+    output.write( line.data(), static_cast<std::streamsize>( line.size() ) );
+  }
+
+  bool Decode( std::istream & input, std::ostream & output, const bool isJson )
+  {
+    Reader reader( input );
+
+    BinaryLogHeader header = {};
+    if ( !reader.Read( header ) || header.m_Magic != BinaryLogHeader::s_Magic ||
+         header.m_TicksPerSecond == 0 )
+    {
+      std::cerr << "Not a Triumph binary log\n";
+      return false;
+    }
+
+    if ( header.m_Version != BinaryLogHeader::s_Version )
+    {
+      std::cerr << std::format( "Unsupported binary log version {}\n",
+                                header.m_Version );
+      return false;
+    }
+
+    const SiteInfo                    Unknown = { 0, 0, {}, "?", "?", "" };
+    std::unordered_map<u32, SiteInfo> sites;
+    std::vector<std::byte>            payload;
+    std::vector<Arg>                  args;
+    std::string                       message;
+
+    BinaryLogEntry entry = {};
+    while ( reader.Read( entry ) )
+    {
+      bool isComplete = false;
+
+      switch ( entry )
+      {
+        case BinaryLogEntry::m_Site:
+        {
+          u32      id    = 0;
+          SiteInfo site  = {};
+          u8       count = 0;
+
+          isComplete = reader.Read( id ) && reader.Read( site.m_Severity ) &&
+                       reader.Read( site.m_Line ) && reader.Read( count );
+          if ( isComplete )
+          {
+            site.m_ArgTypes.resize( count );
+            isComplete = reader.ReadBytes( site.m_ArgTypes.data(), count ) &&
+                         reader.ReadString( site.m_FileName ) &&
+                         reader.ReadString( site.m_FunctionName ) &&
+                         reader.ReadString( site.m_Format );
+          }
+
+          if ( isComplete )
+          {
+            sites[ id ] = std::move( site );
+          }
+          break;
+        }
+
+        case BinaryLogEntry::m_Record:
+        case BinaryLogEntry::m_Text:
+        {
+          u32 siteId   = 0;
+          u32 threadId = 0;
+          u64 tick     = 0;
+
+          isComplete =
+            reader.Read( siteId ) && reader.Read( threadId ) && reader.Read( tick );
+
+          const auto Iterator = sites.find( siteId );
+          const auto & Site   = Iterator != sites.end() ? Iterator->second : Unknown;
+
+          if ( isComplete && entry == BinaryLogEntry::m_Record )
+          {
+            u16 length = 0;
+            isComplete = reader.Read( length );
+            payload.resize( length );
+            isComplete = isComplete && reader.ReadBytes( payload.data(), length );
+
+            message =
+              DecodeArgs( Site.m_ArgTypes, payload, args )
+                ? FormatMessage( Site.m_Format, args )
+                : std::format( "[UNDECODABLE] Raw format: {}", Site.m_Format );
+          }
+          else if ( isComplete )
+          {
+            isComplete = reader.ReadString( message );
+          }
+
+          if ( isComplete )
+          {
+            WriteLine( output, isJson, FormatTime( header, tick ), tick, threadId,
+                       Site, message );
+          }
+          break;
+        }
+
+        default:
+        {
+          std::cerr << std::format( "Unknown entry {}; stopping\n",
+                                    static_cast<u32>( entry ) );
+          return false;
+        }
+      }
+
+      if ( !isComplete )
+      {
+        // Expected when the process died mid-write.
+        std::cerr << "Log is truncated\n";
+        break;
+      }
+    }
+
+    return true;
+  }
+} // namespace
+
+int main( const int argc, char ** argv )
+{
+  bool                     isJson = false;
+  std::vector<std::string> paths;
+
+  for ( int i = 1; i < argc; ++i )
+  {
+    const std::string_view Option( argv[ i ] );
+
+    if ( Option == "--json" )
+    {
+      isJson = true;
+    }
+    else
+    {
+      paths.emplace_back( Option );
+    }
+  }
+
+  if ( paths.empty() || paths.size() > 2 )
+  {
+    std::cerr << "Usage: TriumphLogDecode [--json] <input> [output]\n";
+    return 1;
+  }
+
+  std::ifstream input( paths[ 0 ], std::ios::binary );
+  if ( !input )
+  {
+    std::cerr << std::format( "Cannot open {}\n", paths[ 0 ] );
+    return 1;
+  }
+
+  if ( paths.size() == 1 )
+  {
+    return Decode( input, std::cout, isJson ) ? 0 : 1;
+  }
+
+  std::ofstream output( paths[ 1 ], std::ios::binary | std::ios::trunc );
+  if ( !output )
+  {
+    std::cerr << std::format( "Cannot open {}\n", paths[ 1 ] );
+    return 1;
+  }
+
+  return Decode( input, output, isJson ) ? 0 : 1;
+}
@@ -0,0 +1,366 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <latch>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <Engine/Utility/Logger.hpp>
+#include <Engine/Utility/Logging/BinaryFileSink.hpp>
+#include <Engine/Utility/Logging/LogClock.hpp>
+#include <Engine/Utility/Logging/LogSink.hpp>
+#include <Engine/Utility/Logging/RingSink.hpp>
+#include <Engine/Utility/Logging/RotatingFileSink.hpp>
+
+// Measures the cost of a LOG_* call across formats, sinks, sync/async mode and
+// producer counts, and prints the results as JSON.
+//
+//   TriumphLoggerBench [--iterations N] [--threads N] [--output file.json]
+//
+// The console sink is left out on purpose; it measures the terminal.
+
+namespace
+{
+  using Engine::Utility::Logger;
+  using Engine::Utility::LogClock;
+
+  // Accepts everything and drops it; isolates the cost of the pipeline and of
+  // formatting from any I/O.
+  class NullSink final : public Engine::Utility::LogSink
+  {
+  public:
+    NullSink()
+      : LogSink( Logger::LogSeverity::m_Trace )
+    {
+    }
+
+    void Write( const Engine::Utility::LogRecord &, std::string_view ) override
+    {
+    }
+  };
+
+  enum class SinkKind : u8
+  {
+    m_None,
+    m_Null,
+    m_Ring,
+    m_File,
+    m_Binary,
+  };
+
+  using LogFn = void ( * )( u32 index );
+
+  struct BenchCase
+  {
+    std::string_view m_Name;
+    LogFn            m_pLog;
+    SinkKind         m_Sink;
+    bool             m_IsAsync;
+    bool             m_IsCaptured;
+    u32              m_ThreadCount;
+  };
+
+  struct BenchResult
+  {
+    f64 m_NsPerOp = 0.0;
+    u64 m_P50     = 0;
+    u64 m_P99     = 0;
+    u64 m_P999    = 0;
+  };
+
+  // Measures the timing overhead included in every latency sample.
+  void LogNothing( u32 )
+  {
+  }
+
+  void LogFiltered( const u32 index )
+  {
+    LOG_TRACE( "Filtered {} {}", index, 0.5 );
+  }
+
+  void LogZeroArgs( u32 )
+  {
+    LOG_INFO( "Frame submitted" );
+  }
+
+  void LogMultiArgs( const u32 index )
+  {
+    LOG_INFO( "Frame {} took {} ms on {} (vsync={})", index, 16.6, "Renderer",
+              true );
+  }
+
+  const char * GetSinkName( const SinkKind sink )
+  {
+    switch ( sink )
+    {
+      case SinkKind::m_None:
+      {
+        return "none";
+      }
+
+      case SinkKind::m_Null:
+      {
+        return "null";
+      }
+
+      case SinkKind::m_Ring:
+      {
+        return "ring";
+      }
+
+      case SinkKind::m_File:
+      {
+        return "file";
+      }
+
+      case SinkKind::m_Binary:
+      {
+        return "binary";
+      }
+    }
+
+    return "";
+  }
+
+  std::shared_ptr<Engine::Utility::LogSink>
+    MakeSink( const SinkKind sink, const std::filesystem::path & directory )
+  {
+    switch ( sink )
+    {
+      case SinkKind::m_None:
+      {
+        return nullptr;
+      }
+
+      case SinkKind::m_Null:
+      {
+        return std::make_shared<NullSink>();
+      }
+
+      case SinkKind::m_Ring:
+      {
+        return std::make_shared<Engine::Utility::RingSink>( 1024 );
+      }
+
+      case SinkKind::m_File:
+      {
+        Engine::Utility::RotatingFileSink::Config config = {};
+        config.m_Path     = directory / "TriumphLoggerBench.log";
+        config.m_MaxFiles = 1;
+        return std::make_shared<Engine::Utility::RotatingFileSink>( config );
+      }
+
+      case SinkKind::m_Binary:
+      {
+        return std::make_shared<Engine::Utility::BinaryFileSink>(
+          directory / "TriumphLoggerBench.tlog" );
+      }
+    }
+
+    return nullptr;
+  }
+
+  BenchResult Run( const BenchCase & benchCase, const u32 iterations,
+                   const std::filesystem::path & directory )
+  {
+    Logger::ClearSinks();
+    if ( auto pSink = MakeSink( benchCase.m_Sink, directory ) )
+    {
+      Logger::AddSink( std::move( pSink ) );
+    }
+
+    Logger::SetSeverity( Logger::LogSeverity::m_Info );
+    Logger::SetCaptureSeverity( benchCase.m_IsCaptured
+                                  ? Logger::LogSeverity::m_Trace
+                                  : Logger::LogSeverity::m_Fatal );
+
+    if ( benchCase.m_IsAsync )
+    {
+      Logger::StartAsync( Logger::AsyncConfig {} );
+    }
+
+    std::vector<std::vector<u64>> latencies( benchCase.m_ThreadCount );
+    std::vector<u64>              starts( benchCase.m_ThreadCount );
+    std::vector<std::thread>      threads;
+    std::latch                    start( benchCase.m_ThreadCount );
+
+    for ( u32 t = 0; t < benchCase.m_ThreadCount; ++t )
+    {
+      threads.emplace_back(
+        [ & ]( std::vector<u64> & samples, u64 & begin )
+        {
+          samples.reserve( iterations );
+          start.arrive_and_wait();
+          begin = LogClock::Now();
+
+          for ( u32 i = 0; i < iterations; ++i )
+          {
+            const auto Begin = LogClock::Now();
+            benchCase.m_pLog( i );
+            samples.push_back( LogClock::Now() - Begin );
+          }
+        },
+        std::ref( latencies[ t ] ), std::ref( starts[ t ] ) );
+    }
+
+    for ( auto & thread : threads )
+    {
+      thread.join();
+    }
+
+    // Includes draining the async queue, so this is sustained throughput.
+    Logger::Flush();
+    const auto Elapsed = LogClock::Now() - std::ranges::min( starts );
+
+    Logger::StopAsync();
+    Logger::ClearSinks();
+
+    std::vector<u64> samples;
+    for ( const auto & ThreadSamples : latencies )
+    {
+      samples.insert( samples.end(), ThreadSamples.begin(), ThreadSamples.end() );
+    }
+
+    std::ranges::sort( samples );
+
+    const auto Percentile = [ &samples ]( const f64 fraction )
+    {
+      const auto Index =
+        static_cast<size>( fraction * static_cast<f64>( samples.size() - 1 ) );
+      return static_cast<u64>( LogClock::ToDuration( samples[ Index ] ).count() );
+    };
+
+    const auto ElapsedNs = LogClock::ToDuration( Elapsed ).count();
+
+    BenchResult result = {};
+    result.m_NsPerOp   =
+      static_cast<f64>( ElapsedNs ) / static_cast<f64>( samples.size() );
+    result.m_P50  = Percentile( 0.5 );
+    result.m_P99  = Percentile( 0.99 );
+    result.m_P999 = Percentile( 0.999 );
+
+    return result;
+  }
+
+  std::vector<BenchCase> MakeCases( const u32 maxThreads )
+  {
+    std::vector<u32> threadCounts;
+    for ( u32 count = 1; count < maxThreads; count *= 2 )
+    {
+      threadCounts.push_back( count );
+    }
+    threadCounts.push_back( maxThreads );
+
+    std::vector<BenchCase> cases;
+
+    for ( const auto Threads : threadCounts )
+    {
+      cases.push_back(
+        { "baseline", LogNothing, SinkKind::m_None, false, false, Threads } );
+      cases.push_back( { "filtered", LogFiltered, SinkKind::m_None, false, false,
+                         Threads } );
+      cases.push_back( { "filtered_captured", LogFiltered, SinkKind::m_None, false,
+                         true, Threads } );
+
+      for ( const auto Sink :
+            { SinkKind::m_Null, SinkKind::m_Ring, SinkKind::m_File,
+              SinkKind::m_Binary } )
+      {
+        for ( const auto IsAsync : { false, true } )
+        {
+          cases.push_back(
+            { "zero_args", LogZeroArgs, Sink, IsAsync, false, Threads } );
+          cases.push_back(
+            { "multi_args", LogMultiArgs, Sink, IsAsync, false, Threads } );
+        }
+      }
+    }
+
+    return cases;
+  }
+} // namespace
+
+int main( const int argc, char ** argv )
+{
+  u32         iterations = 100'000;
+  u32         maxThreads = std::max( std::thread::hardware_concurrency(), 1u );
+  std::string outputPath;
+
+  for ( int i = 1; i + 1 < argc; i += 2 )
+  {
+    const std::string_view Option( argv[ i ] );
+    const std::string      Value( argv[ i + 1 ] );
+
+    if ( Option == "--iterations" )
+    {
+      iterations = std::max( static_cast<u32>( std::stoul( Value ) ), 1u );
+    }
+    else if ( Option == "--threads" )
+    {
+      maxThreads = std::max( static_cast<u32>( std::stoul( Value ) ), 1u );
+    }
+    else if ( Option == "--output" )
+    {
+      outputPath = Value;
+    }
+    else
+    {
+      std::cerr << std::format( "Unknown option {}\n", Option );
+      return 1;
+    }
+  }
+
+  const auto Directory = std::filesystem::temp_directory_path();
+  const auto Cases     = MakeCases( maxThreads );
+
+  std::string json = std::format( "{{\n  \"iterations\": {},\n  \"results\": [\n",
+                                  iterations );
+
+  for ( size i = 0; i < Cases.size(); ++i )
+  {
+    const auto & Case   = Cases[ i ];
+    const auto   Result = Run( Case, iterations, Directory );
+
+    json += std::format(
+      "    {{ \"name\": \"{}\", \"sink\": \"{}\", \"async\": {}, "
+      "\"captured\": {}, \"threads\": {}, \"ns_per_op\": {:.2f}, "
+      "\"p50_ns\": {}, \"p99_ns\": {}, \"p999_ns\": {} }}{}\n",
+      Case.m_Name, GetSinkName( Case.m_Sink ), Case.m_IsAsync, Case.m_IsCaptured,
+      Case.m_ThreadCount, Result.m_NsPerOp, Result.m_P50, Result.m_P99,
+      Result.m_P999, i + 1 < Cases.size() ? "," : "" );
+  }
+
+  json += "  ]\n}\n";
+
+  std::error_code error;
+  std::filesystem::remove( Directory / "TriumphLoggerBench.log", error );
+  std::filesystem::remove( Directory / "TriumphLoggerBench.tlog", error );
+
+  if ( outputPath.empty() )
+  {
+    std::cout << json;
+    return 0;
+  }
+
+  std::ofstream output( outputPath, std::ios::trunc );
+  output << json;
+  return output ? 0 : 1;
+}
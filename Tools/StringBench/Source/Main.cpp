@@ -0,0 +1,557 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Engine/Utility/String.hpp>
+#include <Engine/Utility/StringSplit.hpp>
+#include <Engine/Utility/Unicode/UnicodeKernels.hpp>
+
+// Measures every UTF validation, conversion and trim entry point of
+// Utility::String on synthetic corpora and prints the throughput as JSON.
+//
+//   TriumphStringBench [--iterations N] [--size BYTES] [--output file.json]
+//
+// Throughput counts input bytes.  Conversions of the malformed corpus stop at its
+// first bad sequence, so those rows measure the error path.
+
+namespace
+{
+  namespace String  = Engine::Utility::String;
+  namespace Unicode = Engine::Utility::Unicode;
+
+  struct Corpus
+  {
+    std::string_view         m_Name;
+    std::string              m_Utf8;
+    std::u16string           m_Utf16;
+    std::u32string           m_Utf32;
+    std::vector<std::string> m_Lines;
+    size                     m_LineBytes = 0;
+  };
+
+  enum class InputKind : u8
+  {
+    m_Utf8,
+    m_Utf16,
+    m_Utf32,
+    m_Lines,
+  };
+
+  // Returns a value derived from the output so the call is not optimized away.
+  using RunFn = size ( * )( const Corpus & corpus );
+
+  struct BenchCase
+  {
+    std::string_view m_Name;
+    InputKind        m_Input;
+    RunFn            m_pRun;
+  };
+
+  // Output for the span and append cases, sized once so only conversion is timed.
+  std::string    s_Utf8;
+  std::u16string s_Utf16;
+  std::u32string s_Utf32;
+
+  size RunIsUtf8( const Corpus & corpus )
+  {
+    return String::IsUtf8( corpus.m_Utf8 );
+  }
+
+  size RunIsUtf16( const Corpus & corpus )
+  {
+    return String::IsUtf16( corpus.m_Utf16 );
+  }
+
+  size RunIsUtf32( const Corpus & corpus )
+  {
+    return String::IsUtf32( corpus.m_Utf32 );
+  }
+
+  size RunToUtf8Utf16View( const Corpus & corpus )
+  {
+    return String::ToUtf8( std::u16string_view { corpus.m_Utf16 } ).size();
+  }
+
+  size RunToUtf8Utf16String( const Corpus & corpus )
+  {
+    return String::ToUtf8( corpus.m_Utf16 ).size();
+  }
+
+  size RunToUtf8Utf16Pointer( const Corpus & corpus )
+  {
+    return String::ToUtf8( corpus.m_Utf16.c_str() ).size();
+  }
+
+  size RunToUtf8Utf32View( const Corpus & corpus )
+  {
+    return String::ToUtf8( std::u32string_view { corpus.m_Utf32 } ).size();
+  }
+
+  size RunToUtf8Utf32String( const Corpus & corpus )
+  {
+    return String::ToUtf8( corpus.m_Utf32 ).size();
+  }
+
+  size RunToUtf8Utf32Pointer( const Corpus & corpus )
+  {
+    return String::ToUtf8( corpus.m_Utf32.c_str() ).size();
+  }
+
+  size RunToUtf8Utf16Span( const Corpus & corpus )
+  {
+    return String::ToUtf8( corpus.m_Utf16, std::span { s_Utf8 } ).m_Written;
+  }
+
+  size RunToUtf8Utf32Span( const Corpus & corpus )
+  {
+    return String::ToUtf8( corpus.m_Utf32, std::span { s_Utf8 } ).m_Written;
+  }
+
+  size RunAppendUtf8Utf16View( const Corpus & corpus )
+  {
+    s_Utf8.clear();
+    return String::AppendUtf8( corpus.m_Utf16, s_Utf8 ).m_Written;
+  }
+
+  size RunAppendUtf8Utf32View( const Corpus & corpus )
+  {
+    s_Utf8.clear();
+    return String::AppendUtf8( corpus.m_Utf32, s_Utf8 ).m_Written;
+  }
+
+  size RunToUtf16Utf8View( const Corpus & corpus )
+  {
+    return String::ToUtf16( std::string_view { corpus.m_Utf8 } ).size();
+  }
+
+  size RunToUtf16Utf8String( const Corpus & corpus )
+  {
+    return String::ToUtf16( corpus.m_Utf8 ).size();
+  }
+
+  size RunToUtf16Utf8Pointer( const Corpus & corpus )
+  {
+    return String::ToUtf16( corpus.m_Utf8.c_str() ).size();
+  }
+
+  size RunToUtf16Utf32View( const Corpus & corpus )
+  {
+    return String::ToUtf16( std::u32string_view { corpus.m_Utf32 } ).size();
+  }
+
+  size RunToUtf16Utf8Span( const Corpus & corpus )
+  {
+    return String::ToUtf16( corpus.m_Utf8, std::span { s_Utf16 } ).m_Written;
+  }
+
+  size RunToUtf16Utf32Span( const Corpus & corpus )
+  {
+    return String::ToUtf16( corpus.m_Utf32, std::span { s_Utf16 } ).m_Written;
+  }
+
+  size RunAppendUtf16Utf8View( const Corpus & corpus )
+  {
+    s_Utf16.clear();
+    return String::AppendUtf16( corpus.m_Utf8, s_Utf16 ).m_Written;
+  }
+
+  size RunAppendUtf16Utf32View( const Corpus & corpus )
+  {
+    s_Utf16.clear();
+    return String::AppendUtf16( corpus.m_Utf32, s_Utf16 ).m_Written;
+  }
+
+  size RunToUtf32Utf8View( const Corpus & corpus )
+  {
+    return String::ToUtf32( std::string_view { corpus.m_Utf8 } ).size();
+  }
+
+  size RunToUtf32Utf8String( const Corpus & corpus )
+  {
+    return String::ToUtf32( corpus.m_Utf8 ).size();
+  }
+
+  size RunToUtf32Utf8Pointer( const Corpus & corpus )
+  {
+    return String::ToUtf32( corpus.m_Utf8.c_str() ).size();
+  }
+
+  size RunToUtf32Utf16View( const Corpus & corpus )
+  {
+    return String::ToUtf32( std::u16string_view { corpus.m_Utf16 } ).size();
+  }
+
+  size RunToUtf32Utf8Span( const Corpus & corpus )
+  {
+    return String::ToUtf32( corpus.m_Utf8, std::span { s_Utf32 } ).m_Written;
+  }
+
+  size RunToUtf32Utf16Span( const Corpus & corpus )
+  {
+    return String::ToUtf32( corpus.m_Utf16, std::span { s_Utf32 } ).m_Written;
+  }
+
+  size RunAppendUtf32Utf8View( const Corpus & corpus )
+  {
+    s_Utf32.clear();
+    return String::AppendUtf32( corpus.m_Utf8, s_Utf32 ).m_Written;
+  }
+
+  size RunAppendUtf32Utf16View( const Corpus & corpus )
+  {
+    s_Utf32.clear();
+    return String::AppendUtf32( corpus.m_Utf16, s_Utf32 ).m_Written;
+  }
+
+  size RunTrim( const Corpus & corpus )
+  {
+    size total = 0;
+    for ( const auto & Line : corpus.m_Lines )
+    {
+      total += String::Trim( Line ).size();
+    }
+
+    return total;
+  }
+
+  size RunTrimLeft( const Corpus & corpus )
+  {
+    size total = 0;
+    for ( const auto & Line : corpus.m_Lines )
+    {
+      total += String::TrimLeft( Line ).size();
+    }
+
+    return total;
+  }
+
+  size RunTrimRight( const Corpus & corpus )
+  {
+    size total = 0;
+    for ( const auto & Line : corpus.m_Lines )
+    {
+      total += String::TrimRight( Line ).size();
+    }
+
+    return total;
+  }
+
+  size RunTrimView( const Corpus & corpus )
+  {
+    size total = 0;
+    for ( const auto & Line : corpus.m_Lines )
+    {
+      total += String::TrimView( Line ).size();
+    }
+
+    return total;
+  }
+
+  size RunTrimLeftView( const Corpus & corpus )
+  {
+    size total = 0;
+    for ( const auto & Line : corpus.m_Lines )
+    {
+      total += String::TrimLeftView( Line ).size();
+    }
+
+    return total;
+  }
+
+  size RunTrimRightView( const Corpus & corpus )
+  {
+    size total = 0;
+    for ( const auto & Line : corpus.m_Lines )
+    {
+      total += String::TrimRightView( Line ).size();
+    }
+
+    return total;
+  }
+
+  const BenchCase s_Cases[] = {
+    { "IsUtf8", InputKind::m_Utf8, RunIsUtf8 },
+    { "IsUtf16", InputKind::m_Utf16, RunIsUtf16 },
+    { "IsUtf32", InputKind::m_Utf32, RunIsUtf32 },
+    { "ToUtf8(u16string_view)", InputKind::m_Utf16, RunToUtf8Utf16View },
+    { "ToUtf8(const u16string &)", InputKind::m_Utf16, RunToUtf8Utf16String },
+    { "ToUtf8(const c16 *)", InputKind::m_Utf16, RunToUtf8Utf16Pointer },
+    { "ToUtf8(u32string_view)", InputKind::m_Utf32, RunToUtf8Utf32View },
+    { "ToUtf8(const u32string &)", InputKind::m_Utf32, RunToUtf8Utf32String },
+    { "ToUtf8(const c32 *)", InputKind::m_Utf32, RunToUtf8Utf32Pointer },
+    { "ToUtf8(u16string_view, span)", InputKind::m_Utf16, RunToUtf8Utf16Span },
+    { "ToUtf8(u32string_view, span)", InputKind::m_Utf32, RunToUtf8Utf32Span },
+    { "AppendUtf8(u16string_view)", InputKind::m_Utf16, RunAppendUtf8Utf16View },
+    { "AppendUtf8(u32string_view)", InputKind::m_Utf32, RunAppendUtf8Utf32View },
+    { "ToUtf16(string_view)", InputKind::m_Utf8, RunToUtf16Utf8View },
+    { "ToUtf16(const string &)", InputKind::m_Utf8, RunToUtf16Utf8String },
+    { "ToUtf16(const c8 *)", InputKind::m_Utf8, RunToUtf16Utf8Pointer },
+    { "ToUtf16(u32string_view)", InputKind::m_Utf32, RunToUtf16Utf32View },
+    { "ToUtf16(string_view, span)", InputKind::m_Utf8, RunToUtf16Utf8Span },
+    { "ToUtf16(u32string_view, span)", InputKind::m_Utf32, RunToUtf16Utf32Span },
+    { "AppendUtf16(string_view)", InputKind::m_Utf8, RunAppendUtf16Utf8View },
+    { "AppendUtf16(u32string_view)", InputKind::m_Utf32, RunAppendUtf16Utf32View },
+    { "ToUtf32(string_view)", InputKind::m_Utf8, RunToUtf32Utf8View },
+    { "ToUtf32(const string &)", InputKind::m_Utf8, RunToUtf32Utf8String },
+    { "ToUtf32(const c8 *)", InputKind::m_Utf8, RunToUtf32Utf8Pointer },
+    { "ToUtf32(u16string_view)", InputKind::m_Utf16, RunToUtf32Utf16View },
+    { "ToUtf32(string_view, span)", InputKind::m_Utf8, RunToUtf32Utf8Span },
+    { "ToUtf32(u16string_view, span)", InputKind::m_Utf16, RunToUtf32Utf16Span },
+    { "AppendUtf32(string_view)", InputKind::m_Utf8, RunAppendUtf32Utf8View },
+    { "AppendUtf32(u16string_view)", InputKind::m_Utf16, RunAppendUtf32Utf16View },
+    { "Trim", InputKind::m_Lines, RunTrim },
+    { "TrimLeft", InputKind::m_Lines, RunTrimLeft },
+    { "TrimRight", InputKind::m_Lines, RunTrimRight },
+    { "TrimView", InputKind::m_Lines, RunTrimView },
+    { "TrimLeftView", InputKind::m_Lines, RunTrimLeftView },
+    { "TrimRightView", InputKind::m_Lines, RunTrimRightView },
+  };
+
+  // Code points are drawn from the given ranges, with ASCII mixed in at
+  // asciiPercent so the vector kernels see realistic runs.
+  std::u32string MakeText( std::mt19937 & random, const size codePoints,
+                           const u32 asciiPercent, const u32 first, const u32 last )
+  {
+    std::uniform_int_distribution<u32> percent( 0, 99 );
+    std::uniform_int_distribution<u32> ascii( 0x20, 0x7E );
+    std::uniform_int_distribution<u32> other( first, last );
+
+    std::u32string text;
+    text.reserve( codePoints );
+    for ( size i = 0; i < codePoints; ++i )
+    {
+      if ( i % 64 == 63 )
+      {
+        text += U'\n';
+        continue;
+      }
+
+      const auto CodePoint = percent( random ) < asciiPercent ? ascii( random )
+                                                              : other( random );
+      text += static_cast<c32>( CodePoint );
+    }
+
+    return text;
+  }
+
+  Corpus MakeCorpus( const std::string_view name, const std::u32string & text )
+  {
+    Corpus corpus;
+    corpus.m_Name  = name;
+    corpus.m_Utf32 = text;
+    corpus.m_Utf16 = String::ToUtf16( std::u32string_view { text } );
+    corpus.m_Utf8  = String::ToUtf8( std::u32string_view { text } );
+
+    for ( const auto Line : String::Split( corpus.m_Utf8, '\n' ) )
+    {
+      corpus.m_Lines.push_back( std::format( "  \t{}  ", Line ) );
+      corpus.m_LineBytes += corpus.m_Lines.back().size();
+    }
+
+    return corpus;
+  }
+
+  // A bad unit roughly every 4 KiB of each encoding.
+  Corpus MakeMalformed( Corpus corpus )
+  {
+    corpus.m_Name = "malformed";
+    for ( size i = 4000; i < corpus.m_Utf8.size(); i += 4096 )
+    {
+      corpus.m_Utf8[ i ] = static_cast<c8>( 0xFF );
+    }
+
+    for ( size i = 2000; i < corpus.m_Utf16.size(); i += 2048 )
+    {
+      corpus.m_Utf16[ i ] = 0xD800;
+    }
+
+    for ( size i = 1000; i < corpus.m_Utf32.size(); i += 1024 )
+    {
+      corpus.m_Utf32[ i ] = 0xD800;
+    }
+
+    return corpus;
+  }
+
+  size GetInputBytes( const Corpus & corpus, const InputKind input )
+  {
+    switch ( input )
+    {
+      case InputKind::m_Utf8:
+      {
+        return corpus.m_Utf8.size();
+      }
+
+      case InputKind::m_Utf16:
+      {
+        return corpus.m_Utf16.size() * sizeof( c16 );
+      }
+
+      case InputKind::m_Utf32:
+      {
+        return corpus.m_Utf32.size() * sizeof( c32 );
+      }
+
+      case InputKind::m_Lines:
+      {
+        return corpus.m_LineBytes;
+      }
+    }
+
+    return 0;
+  }
+
+  const char * GetLevelName( const Unicode::SimdLevel level )
+  {
+    switch ( level )
+    {
+      case Unicode::SimdLevel::m_Scalar:
+      {
+        return "scalar";
+      }
+
+      case Unicode::SimdLevel::m_Sse4:
+      {
+        return "sse4";
+      }
+
+      case Unicode::SimdLevel::m_Avx2:
+      {
+        return "avx2";
+      }
+
+      case Unicode::SimdLevel::m_Neon:
+      {
+        return "neon";
+      }
+    }
+
+    return "";
+  }
+
+  // Best of the timed runs, after one warm-up run.
+  f64 Run( const BenchCase & benchCase, const Corpus & corpus, const u32 iterations )
+  {
+    using Clock = std::chrono::steady_clock;
+
+    volatile size sink = benchCase.m_pRun( corpus );
+
+    auto best = Clock::duration::max();
+    for ( u32 i = 0; i < iterations; ++i )
+    {
+      const auto Begin = Clock::now();
+      sink             = benchCase.m_pRun( corpus );
+      best             = std::min( best, Clock::now() - Begin );
+    }
+
+    const auto Seconds = std::chrono::duration<f64>( best ).count();
+    return static_cast<f64>( GetInputBytes( corpus, benchCase.m_Input ) ) /
+           std::max( Seconds, 1e-9 ) / 1e9;
+  }
+} // namespace
+
+int main( const int argc, char ** argv )
+{
+  u32         iterations = 20;
+  size        codePoints = 1 << 20;
+  std::string outputPath;
+
+  for ( int i = 1; i + 1 < argc; i += 2 )
+  {
+    const std::string_view Option( argv[ i ] );
+    const std::string      Value( argv[ i + 1 ] );
+
+    if ( Option == "--iterations" )
+    {
+      iterations = std::max( static_cast<u32>( std::stoul( Value ) ), 1u );
+    }
+    else if ( Option == "--size" )
+    {
+      codePoints = std::max( static_cast<size>( std::stoull( Value ) ), size { 1 } );
+    }
+    else if ( Option == "--output" )
+    {
+      outputPath = Value;
+    }
+    else
+    {
+      std::cerr << std::format( "Unknown option {}\n", Option );
+      return 1;
+    }
+  }
+
+  std::mt19937 random( 1234 );
+
+  std::vector<Corpus> corpora;
+  corpora.push_back(
+    MakeCorpus( "ascii", MakeText( random, codePoints, 100, 0x20, 0x7E ) ) );
+  corpora.push_back(
+    MakeCorpus( "latin", MakeText( random, codePoints, 70, 0xA0, 0x24F ) ) );
+  corpora.push_back(
+    MakeCorpus( "cjk", MakeText( random, codePoints, 10, 0x4E00, 0x9FFF ) ) );
+  corpora.push_back(
+    MakeCorpus( "emoji", MakeText( random, codePoints, 50, 0x1F300, 0x1FAFF ) ) );
+  corpora.push_back( MakeMalformed( corpora[ 1 ] ) );
+
+  // UTF-8 is the longest encoding of every corpus, so its length bounds the output.
+  size maxUnits = 0;
+  for ( const auto & Corpus : corpora )
+  {
+    maxUnits = std::max( maxUnits, Corpus.m_Utf8.size() );
+  }
+
+  s_Utf8.resize( maxUnits );
+  s_Utf16.resize( maxUnits );
+  s_Utf32.resize( maxUnits );
+
+  std::string json =
+    std::format( "{{\n  \"simd_level\": \"{}\",\n  \"iterations\": {},\n"
+                 "  \"results\": [\n",
+                 GetLevelName( Unicode::GetSimdLevel() ), iterations );
+
+  const auto CaseCount = std::size( s_Cases );
+  for ( size i = 0; i < corpora.size(); ++i )
+  {
+    for ( size j = 0; j < CaseCount; ++j )
+    {
+      const auto & Case   = s_Cases[ j ];
+      const auto   Rate   = Run( Case, corpora[ i ], iterations );
+      const auto   IsLast = i + 1 == corpora.size() && j + 1 == CaseCount;
+
+      json += std::format(
+        "    {{ \"name\": \"{}\", \"corpus\": \"{}\", \"gb_per_s\": {:.3f} }}{}\n",
+        Case.m_Name, corpora[ i ].m_Name, Rate, IsLast ? "" : "," );
+    }
+  }
+
+  json += "  ]\n}\n";
+
+  if ( outputPath.empty() )
+  {
+    std::cout << json;
+    return 0;
+  }
+
+  std::ofstream output( outputPath, std::ios::trunc );
+  output << json;
+  return output ? 0 : 1;
+}
@@ -0,0 +1,422 @@
+/*--------------------------------------------------------------------------------*
+  Copyright Nintendo.  All rights reserved.
+
+  These coded instructions, statements, and computer programs contain proprietary
+  information of Nintendo and/or its licensed developers and are protected by
+  national and international copyright laws. They may not be disclosed to third
+  parties or copied or duplicated in any form, in whole or in part, without the
+  prior written consent of Nintendo.
+
+  The content herein is highly confidential and should be handled accordingly.
+ *--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Engine/Utility/StreamTranscoder.hpp>
+#include <Engine/Utility/String.hpp>
+#include <Engine/Utility/StringSplit.hpp>
+#include <Engine/Utility/Unicode/UnicodeKernels.hpp>
+
+// Differential fuzz target for Utility::String.  Every vector kernel set the CPU
+// supports is compared against the scalar reference, and the public API is
+// checked for round trips, partial conversion and agreement with std.
+//
+// Built against libFuzzer when TRIUMPH_LIBFUZZER is on.  Otherwise a small
+// driver replays the files given on the command line, or runs random inputs:
+//
+//   TriumphStringFuzz [--runs N] [file...]
+
+namespace
+{
+  namespace String  = Engine::Utility::String;
+  namespace Unicode = Engine::Utility::Unicode;
+
+  [[noreturn]] void Fail( const char * pWhat, const char * pLevel )
+  {
+    std::fprintf( stderr, "Mismatch: %s (%s)\n", pWhat, pLevel );
+    std::abort();
+  }
+
+  void Check( const bool condition, const char * pWhat, const char * pLevel = "api" )
+  {
+    if ( !condition )
+    {
+      Fail( pWhat, pLevel );
+    }
+  }
+
+  const char * GetLevelName( const Unicode::SimdLevel level )
+  {
+    switch ( level )
+    {
+      case Unicode::SimdLevel::m_Scalar:
+      {
+        return "scalar";
+      }
+
+      case Unicode::SimdLevel::m_Sse4:
+      {
+        return "sse4";
+      }
+
+      case Unicode::SimdLevel::m_Avx2:
+      {
+        return "avx2";
+      }
+
+      case Unicode::SimdLevel::m_Neon:
+      {
+        return "neon";
+      }
+    }
+
+    return "";
+  }
+
+  // Levels the CPU cannot run fall back to scalar, which is harmless here.
+  constexpr Unicode::SimdLevel s_Levels[] = {
+    Unicode::SimdLevel::m_Sse4,
+    Unicode::SimdLevel::m_Avx2,
+    Unicode::SimdLevel::m_Neon,
+  };
+
+  template <typename Unit>
+  std::basic_string<Unit> Reinterpret( const std::span<const u8> data )
+  {
+    std::basic_string<Unit> str( data.size() / sizeof( Unit ), 0 );
+    std::memcpy( str.data(), data.data(), str.size() * sizeof( Unit ) );
+    return str;
+  }
+
+  // Turns arbitrary bytes into valid text so the multi-byte paths of the kernels
+  // get exercised, which random bytes rarely reach.  The first byte of each
+  // triple picks the length class, keeping ASCII runs common.
+  std::u32string MakeValidText( const std::span<const u8> data )
+  {
+    std::u32string text;
+    for ( size i = 0; i + 3 <= data.size(); i += 3 )
+    {
+      const u32 Bits = data[ i ] | data[ i + 1 ] << 8 | data[ i + 2 ] << 16;
+
+      u32 codePoint = 0;
+      switch ( data[ i ] & 3 )
+      {
+        case 0:
+        {
+          codePoint = Bits >> 8 & 0x7F;
+          break;
+        }
+
+        case 1:
+        {
+          codePoint = 0x80 + ( Bits >> 8 ) % ( 0x800 - 0x80 );
+          break;
+        }
+
+        case 2:
+        {
+          codePoint = 0x800 + ( Bits >> 8 ) % ( 0x10000 - 0x800 );
+          break;
+        }
+
+        default:
+        {
+          codePoint = 0x10000 + ( Bits >> 2 ) % ( 0x110000 - 0x10000 );
+          break;
+        }
+      }
+
+      if ( codePoint >= 0xD800 && codePoint <= 0xDFFF )
+      {
+        codePoint -= 0x800;
+      }
+
+      text += static_cast<c32>( codePoint );
+    }
+
+    return text;
+  }
+
+  void CheckUtf8Kernels( const std::string_view str )
+  {
+    const auto IsValid = Unicode::Scalar::IsUtf8( str );
+    Check( IsValid == ( Unicode::Scalar::ValidUtf8Length( str ) == str.length() ),
+           "ValidUtf8Length", "scalar" );
+
+    std::u16string utf16;
+    std::u32string utf32;
+    if ( IsValid )
+    {
+      using namespace Unicode::Scalar;
+
+      utf16.resize( Utf16LengthFromUtf8( str ) );
+      utf32.resize( Utf32LengthFromUtf8( str ) );
+      Check( ConvertUtf8ToUtf16( str, utf16.data() ) == utf16.size(),
+             "ConvertUtf8ToUtf16", "scalar" );
+      Check( ConvertUtf8ToUtf32( str, utf32.data() ) == utf32.size(),
+             "ConvertUtf8ToUtf32", "scalar" );
+    }
+
+    for ( const auto Level : s_Levels )
+    {
+      const auto & Kernels = Unicode::GetUnicodeKernels( Level );
+      const auto * pLevel  = GetLevelName( Kernels.m_Level );
+
+      Check( Kernels.m_pIsUtf8( str ) == IsValid, "IsUtf8", pLevel );
+      if ( !IsValid )
+      {
+        continue;
+      }
+
+      Check( Kernels.m_pUtf16LengthFromUtf8( str ) == utf16.size(),
+             "Utf16LengthFromUtf8", pLevel );
+      Check( Kernels.m_pUtf32LengthFromUtf8( str ) == utf32.size(),
+             "Utf32LengthFromUtf8", pLevel );
+
+      std::u16string vectorUtf16( utf16.size(), 0 );
+      std::u32string vectorUtf32( utf32.size(), 0 );
+      Kernels.m_pConvertUtf8ToUtf16( str, vectorUtf16.data() );
+      Kernels.m_pConvertUtf8ToUtf32( str, vectorUtf32.data() );
+      Check( vectorUtf16 == utf16, "ConvertUtf8ToUtf16", pLevel );
+      Check( vectorUtf32 == utf32, "ConvertUtf8ToUtf32", pLevel );
+    }
+  }
+
+  // The UTF-16 or UTF-32 half of a kernel set.
+  template <typename Unit> struct WideKernels
+  {
+    bool ( *m_pIsValid )( std::basic_string_view<Unit> )             = nullptr;
+    size ( *m_pUtf8Length )( std::basic_string_view<Unit> )          = nullptr;
+    size ( *m_pConvertToUtf8 )( std::basic_string_view<Unit>, c8 * ) = nullptr;
+  };
+
+  template <typename Unit>
+  WideKernels<Unit> GetWideKernels( const Unicode::UnicodeKernels & kernels )
+  {
+    if constexpr ( sizeof( Unit ) == sizeof( c16 ) )
+    {
+      return { kernels.m_pIsUtf16, kernels.m_pUtf8LengthFromUtf16,
+               kernels.m_pConvertUtf16ToUtf8 };
+    }
+    else
+    {
+      return { kernels.m_pIsUtf32, kernels.m_pUtf8LengthFromUtf32,
+               kernels.m_pConvertUtf32ToUtf8 };
+    }
+  }
+
+  template <typename Unit>
+  void CheckWideKernels( const std::basic_string_view<Unit> str )
+  {
+    const auto & ScalarKernels =
+      Unicode::GetUnicodeKernels( Unicode::SimdLevel::m_Scalar );
+    const auto Scalar = GetWideKernels<Unit>( ScalarKernels );
+
+    size validUnits = 0;
+    if constexpr ( sizeof( Unit ) == sizeof( c16 ) )
+    {
+      validUnits = Unicode::Scalar::ValidUtf16Length( str );
+    }
+    else
+    {
+      validUnits = Unicode::Scalar::ValidUtf32Length( str );
+    }
+
+    const auto IsValid = Scalar.m_pIsValid( str );
+    Check( IsValid == ( validUnits == str.length() ), "ValidLength", "scalar" );
+
+    std::string utf8;
+    if ( IsValid )
+    {
+      utf8.resize( Scalar.m_pUtf8Length( str ) );
+      Check( Scalar.m_pConvertToUtf8( str, utf8.data() ) == utf8.size(),
+             "ConvertToUtf8", "scalar" );
+    }
+
+    for ( const auto Level : s_Levels )
+    {
+      const auto & Kernels = Unicode::GetUnicodeKernels( Level );
+      const auto * pLevel  = GetLevelName( Kernels.m_Level );
+      const auto   Vector  = GetWideKernels<Unit>( Kernels );
+
+      Check( Vector.m_pIsValid( str ) == IsValid, "IsUtf16/IsUtf32", pLevel );
+      if ( !IsValid )
+      {
+        continue;
+      }
+
+      Check( Vector.m_pUtf8Length( str ) == utf8.size(), "Utf8Length", pLevel );
+
+      std::string vectorUtf8( utf8.size(), 0 );
+      Vector.m_pConvertToUtf8( str, vectorUtf8.data() );
+      Check( vectorUtf8 == utf8, "ConvertToUtf8", pLevel );
+    }
+  }
+
+  // Valid text must survive every round trip; malformed text must be rejected by
+  // every whole-string converter.
+  void CheckRoundTrips( const std::string_view str, const u8 seed )
+  {
+    const auto Utf16 = String::ToUtf16( str );
+    const auto Utf32 = String::ToUtf32( str );
+    if ( !String::IsUtf8( str ) )
+    {
+      Check( Utf16.empty() && Utf32.empty(), "ToUtf16/ToUtf32 of malformed input" );
+      return;
+    }
+
+    Check( String::ToUtf8( std::u16string_view { Utf16 } ) == str, "8 -> 16 -> 8" );
+    Check( String::ToUtf8( std::u32string_view { Utf32 } ) == str, "8 -> 32 -> 8" );
+    Check( String::ToUtf32( std::u16string_view { Utf16 } ) == Utf32, "16 -> 32" );
+    Check( String::ToUtf16( std::u32string_view { Utf32 } ) == Utf16, "32 -> 16" );
+
+    // A buffer too small must yield a prefix of the full result ending on a code
+    // point boundary.
+    std::u16string partial( Utf16.size() * seed / 255, 0 );
+    const auto     Result = String::ToUtf16( str, std::span { partial } );
+    Check( Result.m_Written <= partial.size() && Result.m_Read <= str.length(),
+           "span bounds" );
+    Check( std::u16string_view { Utf16 }.starts_with(
+             std::u16string_view { partial.data(), Result.m_Written } ),
+           "span prefix" );
+    Check( Result.IsOk() == ( Result.m_Written == Utf16.size() ), "span status" );
+    Check( String::ToUtf16( str.substr( 0, Result.m_Read ) ).size() ==
+             Result.m_Written,
+           "span read offset" );
+
+    // Streaming in uneven chunks must match the whole-string conversion.
+    String::Utf8ToUtf32Stream stream;
+    std::u32string            streamed;
+    const size                Step = seed % 7 + 1;
+    for ( size i = 0; i < str.length(); i += Step )
+    {
+      Check( stream.Feed( str.substr( i, Step ), streamed ).IsOk(), "Feed" );
+    }
+
+    Check( stream.Finish().IsOk() && streamed == Utf32, "StreamTranscoder" );
+  }
+
+  void CheckScanning( const std::string_view str, const std::span<const u8> data )
+  {
+    // Sets taken from the input, covering the splatted and table paths.
+    const auto * pBytes = reinterpret_cast<const c8 *>( data.data() );
+    for ( size length = 0; length <= std::min<size>( data.size(), 12 ); length += 3 )
+    {
+      const std::string_view Set( pBytes, length );
+      Check( String::FindFirstOf( str, Set ) == str.find_first_of( Set ),
+             "FindFirstOf" );
+      Check( String::FindFirstNotOf( str, Set ) == str.find_first_not_of( Set ),
+             "FindFirstNotOf" );
+      Check( String::FindLastNotOf( str, Set ) == str.find_last_not_of( Set ),
+             "FindLastNotOf" );
+    }
+
+    const auto First    = str.find_first_not_of( String::s_Whitespace );
+    const auto Last     = str.find_last_not_of( String::s_Whitespace );
+    const auto Expected = First == std::string_view::npos
+                            ? std::string_view {}
+                            : str.substr( First, Last - First + 1 );
+    Check( String::TrimView( str ) == Expected && String::Trim( str ) == Expected,
+           "Trim" );
+
+    // Joining the fields with the delimiter must give back the input.
+    const auto Delimiter = data.empty() ? ',' : static_cast<c8>( data[ 0 ] );
+
+    std::string joined;
+    for ( const auto Field : String::Split( str, Delimiter ) )
+    {
+      joined += Field;
+      joined += Delimiter;
+    }
+
+    joined.pop_back();
+    Check( joined == str, "Split" );
+  }
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput( const u8 * pData, const size length )
+{
+  const std::span   Data( pData, length );
+  const std::string Bytes( reinterpret_cast<const c8 *>( pData ), length );
+
+  const auto Seed  = length == 0 ? u8 { 0 } : pData[ length - 1 ];
+  const auto Text  = MakeValidText( Data );
+  const auto Utf8  = String::ToUtf8( std::u32string_view { Text } );
+  const auto Utf16 = String::ToUtf16( std::u32string_view { Text } );
+
+  CheckUtf8Kernels( Bytes );
+  CheckUtf8Kernels( Utf8 );
+  CheckWideKernels<c16>( Reinterpret<c16>( Data ) );
+  CheckWideKernels<c16>( Utf16 );
+  CheckWideKernels<c32>( Reinterpret<c32>( Data ) );
+  CheckWideKernels<c32>( Text );
+
+  CheckRoundTrips( Bytes, Seed );
+  CheckRoundTrips( Utf8, Seed );
+
+  CheckScanning( Bytes, Data );
+  return 0;
+}
+
+#if defined( TRIUMPH_FUZZ_STANDALONE )
+int main( const int argc, char ** argv )
+{
+  u32                      runs = 100'000;
+  std::vector<std::string> files;
+
+  for ( int i = 1; i < argc; ++i )
+  {
+    const std::string_view Option( argv[ i ] );
+    if ( Option == "--runs" && i + 1 < argc )
+    {
+      runs = static_cast<u32>( std::stoul( argv[ ++i ] ) );
+    }
+    else
+    {
+      files.emplace_back( Option );
+    }
+  }
+
+  for ( const auto & File : files )
+  {
+    std::ifstream   input( File, std::ios::binary );
+    std::vector<u8> data( std::istreambuf_iterator<c8>( input ), {} );
+    LLVMFuzzerTestOneInput( data.data(), data.size() );
+  }
+
+  if ( !files.empty() )
+  {
+    return 0;
+  }
+
+  // Lengths straddle the 16, 32 and 64 byte blocks of the vector kernels.
+  std::mt19937                       random( 1 );
+  std::uniform_int_distribution<u32> lengths( 0, 300 );
+  std::uniform_int_distribution<u32> bytes( 0, 255 );
+
+  std::vector<u8> data;
+  for ( u32 run = 0; run < runs; ++run )
+  {
+    data.resize( lengths( random ) );
+    for ( auto & byte : data )
+    {
+      byte = static_cast<u8>( bytes( random ) );
+    }
+
+    LLVMFuzzerTestOneInput( data.data(), data.size() );
+  }
+
+  std::printf( "%u runs passed\n", runs );
+  return 0;
+}
+#endif